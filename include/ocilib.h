@@ -65,6 +65,7 @@ extern "C" {
 #include <string.h>
 #include <time.h>
 #include <limits.h>
+#include <stdint.h>
 
 /* --------------------------------------------------------------------------------------------- *
  * MS Windows platform detection
@@ -353,6 +354,17 @@ OCI_EXPORT int ociwcscasecmp
  * @}
  */
 
+/* boolean values */
+
+#ifndef TRUE
+  #define TRUE                   1
+  #define FALSE                  0
+#endif
+
+#ifndef boolean
+  #define boolean int
+#endif
+
 /**
  * @defgroup OcilibCApiDatatypes Data types
  * @{
@@ -932,6 +944,37 @@ typedef void (*POCI_HA_HANDLER)
     OCI_Timestamp  *time
 );
 
+/**
+ * @typedef POCI_LONG_HANDLER
+ *
+ * @brief
+ * LONG pieces streaming User callback prototype.
+ *
+ * @param rs     - Resultset handle
+ * @param index  - Column index (starting at 1)
+ * @param row    - Row number the piece belongs to
+ * @param buffer - Piece data
+ * @param size   - Piece size (in characters for LONG and in bytes for LONG RAW)
+ * @param last   - TRUE if the piece is the last one of the value
+ *
+ * @note
+ * For LONG columns, the buffer is a zero terminated string of otext characters
+ *
+ * @note
+ * The buffer is only valid during the callback call
+ *
+ */
+
+typedef void (*POCI_LONG_HANDLER)
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int   row,
+    const void    *buffer,
+    unsigned int   size,
+    boolean        last
+);
+
 /* public structures */
 
 /**
@@ -1055,20 +1098,66 @@ typedef unsigned int big_uint;
 #endif
 
 /**
- * @}
+ * @struct ArrowSchema
+ *
+ * @brief
+ * Apache Arrow C data interface schema description
+ *
+ * @note
+ * Structure defined by the Arrow C data interface specification, used to export
+ * the columns description of a resultset (see OCI_GetArrowSchema())
+ *
+ * @struct ArrowArray
+ *
+ * @brief
+ * Apache Arrow C data interface array
+ *
+ * @note
+ * Structure defined by the Arrow C data interface specification, used to export
+ * a batch of rows of a resultset (see OCI_FetchArrowBatch())
+ *
  */
 
-/* boolean values */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
 
-#ifndef TRUE
-  #define TRUE                   1
-  #define FALSE                  0
-#endif
+#define ARROW_FLAG_DICTIONARY_ORDERED   1
+#define ARROW_FLAG_NULLABLE             2
+#define ARROW_FLAG_MAP_KEYS_SORTED      4
+
+struct ArrowSchema
+{
+    const char          *format;
+    const char          *name;
+    const char          *metadata;
+    int64_t              flags;
+    int64_t              n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema  *dictionary;
+    void               (*release)(struct ArrowSchema *);
+    void                *private_data;
+};
+
+struct ArrowArray
+{
+    int64_t              length;
+    int64_t              null_count;
+    int64_t              offset;
+    int64_t              n_buffers;
+    int64_t              n_children;
+    const void         **buffers;
+    struct ArrowArray  **children;
+    struct ArrowArray   *dictionary;
+    void               (*release)(struct ArrowArray *);
+    void                *private_data;
+};
 
-#ifndef boolean
-  #define boolean int
 #endif
 
+/**
+ * @}
+ */
+
 /* versions extract macros */
 
 #define OCI_VER_MAJ(v)                      (unsigned int) ((v)/100)
@@ -1135,8 +1224,9 @@ typedef unsigned int big_uint;
 #define OCI_ERR_XA_ENV_FROM_STRING          28
 #define OCI_ERR_XA_CONN_FROM_STRING         29
 #define OCI_ERR_BIND_EXTERNAL_NOT_ALLOWED   30
+#define OCI_ERR_STREAM_WRITE                31
 
-#define OCI_ERR_COUNT                       31   
+#define OCI_ERR_COUNT                       32   
 
 
 /* allocated bytes types */
@@ -1156,6 +1246,10 @@ typedef unsigned int big_uint;
 
 #define OCI_FETCH_SIZE                      20
 #define OCI_PREFETCH_SIZE                   20
+
+/* statement caching */
+
+#define OCI_CACHED_STMT_LIMIT               20
 #define OCI_LONG_EXPLICIT                   1
 #define OCI_LONG_IMPLICIT                   2
 
@@ -2025,6 +2119,56 @@ OCI_EXPORT big_uint OCI_API OCI_GetAllocatedBytes
     unsigned int mem_type
 );
 
+/**
+* @brief
+* Return the number of internal memory pools
+*
+* @note
+* OCILIB recycles small fixed size internal structures (dates, timestamps, lobs, hash entries...)
+* through per type memory pools with per thread caches, avoiding malloc() calls for frequent
+* creation/destruction cycles.
+*
+* @note
+* Returns 0 if memory pools are not supported by the compiler used to build OCILIB
+*
+*/
+
+OCI_EXPORT unsigned int OCI_API OCI_GetMemoryPoolCount
+(
+    void
+);
+
+/**
+* @brief
+* Return allocation statistics of a given internal memory pool
+*
+* @param index  - Pool index (starting at 1)
+* @param name   - Pointer to the name of the type of structures managed by the pool
+* @param allocs - Pointer to the number of allocations
+* @param hits   - Pointer to the number of allocations served from the pool
+* @param frees  - Pointer to the number of deallocations
+*
+* @note
+* Any output parameter can be NULL.
+*
+* @note
+* Statistics are gathered per thread and periodically aggregated. Thus values returned may not
+* include the most recent operations performed by other threads.
+*
+* @return
+* TRUE on success otherwise FALSE
+*
+*/
+
+OCI_EXPORT boolean OCI_API OCI_GetMemoryPoolStats
+(
+    unsigned int   index,
+    const otext  **name,
+    big_uint      *allocs,
+    big_uint      *hits,
+    big_uint      *frees
+);
+
 /**
  * @brief
  * Enable or disable Oracle warning notifications
@@ -2157,6 +2301,30 @@ OCI_EXPORT OCI_Error * OCI_API OCI_GetLastError
     void
 );
 
+/**
+ * @brief
+ * Return the address of a flag telling if an error is pending for the calling thread
+ *
+ * @note
+ * The flag is TRUE when the last OCILIB call of the calling thread raised an error
+ * or a warning that can be retrieved with OCI_GetLastError().
+ * It is meant for wrappers that need to check for errors after each call : when the
+ * flag is FALSE, OCI_GetLastError() returns NULL and does not need to be called.
+ *
+ * @note
+ * The returned address remains valid for the lifetime of the calling thread
+ *
+ * @return
+ * The flag address or NULL if thread local storage is not supported by the compiler
+ * used to build OCILIB
+ *
+ */
+
+OCI_EXPORT const boolean * OCI_API OCI_GetLastErrorFlag
+(
+    void
+);
+
 /**
  * @brief
  * Retrieve error message from error handle
@@ -3114,6 +3282,46 @@ OCI_EXPORT boolean OCI_API OCI_SetStatementCacheSize
     unsigned int     value
 );
 
+/**
+ * @brief
+ * Return the maximum number of idle statements kept by OCI_GetCachedStatement()
+ *
+ * @param con  - Connection handle
+ *
+ * @note
+ * Default value is OCI_CACHED_STMT_LIMIT
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetCachedStatementLimit
+(
+    OCI_Connection  *con
+);
+
+/**
+ * @brief
+ * Set the maximum number of idle statements kept by OCI_GetCachedStatement()
+ *
+ * @param con   - Connection handle
+ * @param value - maximum number of idle statements
+ *
+ * @note
+ * Unlike OCI_SetStatementCacheSize() that only saves the server side parsing, this cache
+ * keeps the prepared OCILIB statement objects with the description of their select list.
+ * Least recently used idle statements exceeding the new limit are freed.
+ * Setting the value to 0 disables the cache.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetCachedStatementLimit
+(
+    OCI_Connection  *con,
+    unsigned int     value
+);
+
 /**
  * @brief
  * Return the default LOB prefetch buffer size for the connection
@@ -3868,6 +4076,41 @@ OCI_EXPORT boolean OCI_API OCI_StatementFree
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Return a prepared statement for the given SQL from the connection statement cache
+ *
+ * @param con - Connection handle
+ * @param sql - SQL order or PL/SQL block
+ *
+ * @note
+ * If an idle statement prepared with the same SQL text is available in the connection
+ * cache, it is returned without being prepared again and the description of its select
+ * list is reused by its next execution. Otherwise, a new statement is created and prepared.
+ *
+ * @note
+ * Calling OCI_StatementFree() on a statement returned by this call puts it back into the
+ * cache instead of destroying it. When the cache is full, the least recently used idle
+ * statement is freed.
+ *
+ * @note
+ * A statement put back into the cache is handed to the next caller as if it was just
+ * prepared : its resultsets, batch errors and binds are released and its attributes
+ * (bind mode, fetch and prefetch sizes, fetch mode, long settings, ...) are restored to
+ * their default values. Host variables must thus be bound again before each execution.
+ * Rebinding is always allowed on cached statements (see OCI_AllowRebinding()).
+ *
+ * @return
+ * A statement handle on success otherwise NULL
+ *
+ */
+
+OCI_EXPORT OCI_Statement * OCI_API OCI_GetCachedStatement
+(
+    OCI_Connection *con,
+    const otext    *sql
+);
+
 /**
  * @brief
  * Prepare a SQL statement or PL/SQL block.
@@ -4296,6 +4539,105 @@ OCI_EXPORT unsigned int OCI_API OCI_BindArrayGetSize
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Set the maximum number of array DML iterations sent to the server in a single round trip
+ *
+ * @param stmt - Statement handle
+ * @param size - maximum number of iterations per execution (0 for no limit)
+ *
+ * @note
+ * When the bind array size (see OCI_BindArraySetSize()) exceeds the chunk size or the
+ * chunk memory budget (see OCI_BindArraySetChunkMemory()), OCI_Execute() internally
+ * executes the statement several times on consecutive slices of the same bind arrays.
+ * No extra bind buffer is allocated.
+ *
+ * @note
+ * For chunked executions:
+ * - OCI_GetAffectedRows() returns the total number of rows affected by all chunks
+ * - Batch errors of all chunks are reported by OCI_GetBatchError() with row offsets
+ *   relative to the whole bind arrays
+ * - rows in error do not prevent following chunks to be executed but any other error
+ *   stops the execution
+ * - OCI_GetSqlErrorPos() returns the parse error position reported by the first failing chunk
+ * - when auto commit mode is enabled, the commit happens once all chunks are executed
+ *
+ * @note
+ * Chunking is not applied to PL/SQL blocks, statements with register binds
+ * (returning into clauses) or statements with OCI_Long binds
+ *
+ * @note
+ * Default value is 0 (no chunking)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindArraySetChunkSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the maximum number of array DML iterations sent to the server in a single round trip
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_BindArraySetChunkSize() for details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_BindArrayGetChunkSize
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the memory budget of bind array data sent to the server in a single round trip
+ *
+ * @param stmt - Statement handle
+ * @param size - maximum size in bytes (0 for no limit)
+ *
+ * @note
+ * The number of iterations of each chunk is computed from the element size of the array
+ * binds (data, indicator and length) and is also limited by OCI_BindArraySetChunkSize()
+ * See OCI_BindArraySetChunkSize() for details
+ *
+ * @note
+ * Default value is 0 (no limit)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindArraySetChunkMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the memory budget of bind array data sent to the server in a single round trip
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_BindArraySetChunkMemory() for details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_BindArrayGetChunkMemory
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Allow different host variables to be binded using the same bind name or
@@ -4339,6 +4681,62 @@ OCI_EXPORT boolean OCI_API OCI_IsRebindingAllowed
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Only process binds modified since the last execution of the statement
+ *
+ * @param stmt  - Statement handle
+ * @param value - Enable or disable bind tracking
+ *
+ * @note
+ * Before each execution, OCILIB refreshes bind buffers from host variables (indicators,
+ * handles, numeric and string conversions) and copies output values back afterwards.
+ * When bind tracking is enabled, binds that have not been modified since the last execution
+ * are skipped. A bind is marked as modified when it is (re)binded, when calling
+ * OCI_BindSetNull(), OCI_BindSetNotNull(), OCI_BindSetDataSize(), OCI_BindSetDirection()
+ * (and their 'AtPos' variants), when the bind array size changes, or explicitly with OCI_BindSetDirty().
+ *
+ * @note
+ * Bind tracking only applies to input values. Output values of binds whose direction
+ * includes OCI_BDM_OUT (OCI_BDM_IN_OUT being the default) are always copied back to host
+ * variables after execution, whether the bind was modified or not.
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @warning
+ * When bind tracking is enabled, OCI_BindSetDirty() MUST be called after modifying the
+ * value of host variables that are not directly used by OCI (OCILIB objects such as
+ * OCI_Date, OCI_Number, OCI_Lob..., big_int values, strings requiring a charset conversion)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_EnableBindTracking
+(
+    OCI_Statement *stmt,
+    boolean        value
+);
+
+/**
+ * @brief
+ * Indicate if bind tracking is enabled on the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_EnableBindTracking() for more details
+ *
+ * @return
+ * TRUE if enabled otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_IsBindTrackingEnabled
+(
+    OCI_Statement *stmt
+);
+
 /**
 * @brief
 * Bind a boolean variable (PL/SQL ONLY)
@@ -5629,6 +6027,45 @@ OCI_EXPORT unsigned int OCI_API OCI_BindGetDirection
     OCI_Bind *bnd
 );
 
+/**
+ * @brief
+ * Mark the host variable of the given bind as modified
+ *
+ * @param bnd - Bind handle
+ *
+ * @note
+ * Only meaningful when bind tracking is enabled (see OCI_EnableBindTracking()).
+ * The bind is processed again at the next statement execution.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindSetDirty
+(
+    OCI_Bind *bnd
+);
+
+/**
+ * @brief
+ * Indicate if the given bind has been modified since the last statement execution
+ *
+ * @param bnd - Bind handle
+ *
+ * @note
+ * See OCI_EnableBindTracking() for more details
+ *
+ * @return
+ * TRUE if the bind is marked as modified otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindIsDirty
+(
+    OCI_Bind *bnd
+);
+
 /**
  * @brief
  * Return the OCILIB type of the given bind
@@ -6504,6 +6941,36 @@ OCI_EXPORT unsigned int OCI_API OCI_GetColumnIndex
     const otext   *name
 );
 
+/**
+ * @brief
+ * Check if the column at the given index can be retrieved as the given type
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ * @param type  - Data type (see OCI_CDT_XXX values)
+ *
+ * @note
+ * A column matches its own type. Numeric values can also be retrieved from
+ * character columns and any column can be retrieved as a string (OCI_CDT_TEXT)
+ *
+ * @note
+ * If the column does not match, an OCI_ERR_NOT_COMPATIBLE error is raised
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @return
+ * TRUE if the column matches the given type otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_CheckColumnType
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int   type
+);
+
 /**
  * @brief
  * Return the name of the given column
@@ -6986,6 +7453,40 @@ OCI_EXPORT boolean OCI_API OCI_GetStruct
     void          *row_struct_ind
 );
 
+/**
+ * @brief
+ * Return the rows of the last batch fetched by OCI_FetchBatch() into an array of structures
+ *
+ * @param rs               - Resultset handle
+ * @param row_structs      - pointer to an array of user row structures
+ * @param row_struct_inds  - pointer to an array of user indicator structures
+ * @param count            - number of elements of the arrays
+ *
+ * @note
+ * Structures follow the same rules as OCI_GetStruct(). Rows are stored contiguously
+ * in the arrays, as in a regular C array of the user structures.
+ *
+ * @note
+ * Only numeric, character (excepted LONG) and RAW columns are supported as their values
+ * are directly taken from the fetch buffers. Character and RAW members point to the
+ * fetch buffers and are valid until the next fetch call.
+ *
+ * @note
+ * The user indicator structures pointer is not mandatory
+ *
+ * @return
+ * Number of rows returned into the arrays
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetStructs
+(
+    OCI_Resultset *rs,
+    void          *row_structs,
+    void          *row_struct_inds,
+    unsigned int   count
+);
+
 /**
 * @brief
 * Return the current Number value of the column at the given index in the resultset
@@ -7319,6 +7820,35 @@ OCI_EXPORT const otext * OCI_API OCI_GetString
     unsigned int   index
 );
 
+/**
+ * @brief
+ * Return the current string value of the column at the given index in the resultset with its length
+ *
+ * @param rs     - Resultset handle
+ * @param index  - Column position
+ * @param length - Pointer to the string length in characters
+ *
+ * @note
+ * This call is identical to OCI_GetString() but also returns the string length.
+ * For character columns, the length comes from the data length reported by Oracle
+ * and the returned pointer refers to the fetch buffer without copy.
+ * It remains valid until the next fetch call.
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @return
+ * The column current row value or NULL if index is out of bounds or if the value is NULL
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_GetStringWithLength
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int  *length
+);
+
 /**
  * @brief
  * Return the current string value of the column from its name in the resultset
@@ -7887,7 +8417,205 @@ OCI_EXPORT boolean OCI_API OCI_IsNull
 
 /**
  * @brief
- * Return the size of the value of the column at the given index in the resultset
+ * Return the size of the value of the column at the given index in the resultset
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @warning
+ * For binds of type OCI_CDT_TEXT (strings), the returned value is expressed in
+ * number of characters.
+ *
+ * @return value size of 0 if the value is NULL
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetDataSize
+(
+    OCI_Resultset *rs,
+    unsigned int   index
+);
+
+/**
+ * @brief
+ * Return the size of the value of the column from its name in the resultset
+ *
+ * @param rs    - Resultset handle
+ * @param name  - Column name
+ *
+ * @warning
+ * For binds of type OCI_CDT_TEXT (strings), the returned value is expressed in
+ * number of characters.
+ *
+ * @return value size of 0 if the value is NULL
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetDataSize2
+(
+    OCI_Resultset *rs,
+    const otext   *name
+);
+
+/**
+ * @brief
+ * Check if the current row value is null for the column of the given name in the resultset
+ *
+ * @param rs    - Resultset handle
+ * @param name  - Column name
+ *
+ * @return
+ * TRUE if it's null otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_IsNull2
+(
+    OCI_Resultset *rs,
+    const otext   *name
+);
+
+/**
+ * @brief
+ * Return the statement handle associated with a resultset handle
+ *
+ * @param rs - resultset handle
+ *
+ */
+
+OCI_EXPORT OCI_Statement * OCI_API OCI_ResultsetGetStatement
+(
+    OCI_Resultset *rs
+);
+
+/**
+ * @brief
+ * Return the current row data length of the column at the given index in the resultset
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @return
+ * The column current row data length or 0 if index is out of bounds
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetDataLength
+(
+    OCI_Resultset *rs,
+    unsigned int   index
+);
+
+/**
+ * @brief
+ * Fetch the next array of rows of the resultset as a single columnar batch
+ *
+ * @param rs   - Resultset handle
+ * @param rows - Pointer to the number of rows of the batch
+ *
+ * @note
+ * A batch is made of the rows of the internal fetch array (see OCI_SetFetchSize())
+ * that have not been consumed yet. If OCI_FetchNext() was called before on the
+ * current array, the batch only contains its remaining rows.
+ *
+ * @note
+ * Once the batch is fetched, column values can be accessed at once using
+ * OCI_GetBatchData(), OCI_GetBatchIndicators(), OCI_GetBatchLengths() and
+ * OCI_GetBatchNumbers(). Regular getters such as OCI_GetInt() return the
+ * values of the last row of the batch.
+ *
+ * @note
+ * Batch column vectors are valid until the next fetch call on the resultset.
+ * Single row fetches such as OCI_FetchNext() end the current batch: batch
+ * getters then return NULL (or 0 for OCI_GetBatchNumbers()) until the next
+ * call to OCI_FetchBatch().
+ *
+ * @warning
+ * Only forward fetching is supported. Mixing OCI_FetchBatch() with OCI_FetchPrev()
+ * or OCI_FetchSeek() on scrollable resultsets leads to undefined batches.
+ *
+ * @return
+ * TRUE on success otherwise FALSE if :
+ * - Empty resultset
+ * - Last row already fetched
+ * - An error occurred
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_FetchBatch
+(
+    OCI_Resultset *rs,
+    unsigned int  *rows
+);
+
+/**
+ * @brief
+ * Return the data vector of the column at the given index for the last fetched batch
+ *
+ * @param rs     - Resultset handle
+ * @param index  - Column position
+ * @param stride - Pointer to the size in bytes of a row value in the vector (can be NULL)
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @note
+ * The returned vector holds the values of the batch rows, each one located at
+ * (row * stride) bytes from the vector start. Values use the internal column buffer format:
+ * - OCI_CDT_NUMERIC : OCINumber or native float/double depending on the column subtype
+ * - OCI_CDT_TEXT : null terminated otext strings
+ * - OCI_CDT_RAW : raw bytes (see OCI_GetBatchLengths() for sizes)
+ * - OCI_CDT_DATETIME : OCIDate structures
+ * - OCI_CDT_BOOLEAN : boolean values
+ *
+ * @note
+ * Only columns of the types listed above are supported.
+ *
+ * @return
+ * The vector start address or NULL on failure
+ *
+ */
+
+OCI_EXPORT const void * OCI_API OCI_GetBatchData
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int  *stride
+);
+
+/**
+ * @brief
+ * Return the null indicator vector of the column at the given index for the last fetched batch
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @note
+ * A batch row value is null if its indicator is equal to -1
+ *
+ * @return
+ * The indicator vector start address or NULL on failure
+ *
+ */
+
+OCI_EXPORT const short * OCI_API OCI_GetBatchIndicators
+(
+    OCI_Resultset *rs,
+    unsigned int   index
+);
+
+/**
+ * @brief
+ * Return the data length vector of the column at the given index for the last fetched batch
  *
  * @param rs    - Resultset handle
  * @param index - Column position
@@ -7895,15 +8623,18 @@ OCI_EXPORT boolean OCI_API OCI_IsNull
  * @note
  * Column position starts at 1.
  *
+ * @note
+ * Lengths are expressed in bytes as returned by the server
+ *
  * @warning
- * For binds of type OCI_CDT_TEXT (strings), the returned value is expressed in
- * number of characters.
+ * Not supported for resultsets returned by DML statements using a returning clause
  *
- * @return value size of 0 if the value is NULL
+ * @return
+ * The length vector start address or NULL on failure
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_GetDataSize
+OCI_EXPORT const unsigned short * OCI_API OCI_GetBatchLengths
 (
     OCI_Resultset *rs,
     unsigned int   index
@@ -7911,75 +8642,136 @@ OCI_EXPORT unsigned int OCI_API OCI_GetDataSize
 
 /**
  * @brief
- * Return the size of the value of the column from its name in the resultset
+ * Convert the numeric column at the given index for the last fetched batch into an array of numbers
  *
- * @param rs    - Resultset handle
- * @param name  - Column name
+ * @param rs     - Resultset handle
+ * @param index  - Column position
+ * @param values - Array of numeric values to fill
+ * @param type   - Type of the array elements
  *
- * @warning
- * For binds of type OCI_CDT_TEXT (strings), the returned value is expressed in
- * number of characters.
+ * @note
+ * Column position starts at 1.
  *
- * @return value size of 0 if the value is NULL
+ * @note
+ * Possible values for parameter 'type' :
+ * - OCI_NUM_SHORT
+ * - OCI_NUM_USHORT
+ * - OCI_NUM_INT
+ * - OCI_NUM_UINT
+ * - OCI_NUM_BIGINT
+ * - OCI_NUM_BIGUINT
+ * - OCI_NUM_DOUBLE
+ * - OCI_NUM_FLOAT
+ * - OCI_NUM_NUMBER
+ *
+ * @note
+ * The array must be large enough to hold the number of rows of the batch.
+ *
+ * @note
+ * Values of null rows are set to 0. Use OCI_GetBatchIndicators() to identify them.
+ *
+ * @return
+ * The number of values converted or 0 on failure
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_GetDataSize2
+OCI_EXPORT unsigned int OCI_API OCI_GetBatchNumbers
 (
     OCI_Resultset *rs,
-    const otext   *name
+    unsigned int   index,
+    void          *values,
+    unsigned int   type
 );
 
 /**
  * @brief
- * Check if the current row value is null for the column of the given name in the resultset
+ * Describe the columns of the resultset as an Apache Arrow struct schema
  *
- * @param rs    - Resultset handle
- * @param name  - Column name
+ * @param rs     - Resultset handle
+ * @param schema - Arrow C data interface schema to fill
+ *
+ * @note
+ * The schema is a struct type ("+s") with one child per column. Columns are mapped as follows :
+ * - OCI_CDT_NUMERIC : native subtypes to their Arrow integer or floating point counterpart,
+ *   NUMBER columns with a null scale and a precision up to 18 to int64, other NUMBER columns to float64
+ * - OCI_CDT_TEXT : utf8
+ * - OCI_CDT_RAW : binary
+ * - OCI_CDT_BOOLEAN : bool
+ * - OCI_CDT_DATETIME : timestamp in seconds without time zone
+ * - OCI_CDT_TIMESTAMP : timestamp in microseconds, without time zone for OCI_TIMESTAMP
+ *   and in UTC for OCI_TIMESTAMP_TZ and OCI_TIMESTAMP_LTZ
+ *
+ * @note
+ * Other column types are not supported.
+ *
+ * @note
+ * The schema must be released by calling its release callback once not needed anymore.
  *
  * @return
- * TRUE if it's null otherwise FALSE
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_IsNull2
+OCI_EXPORT boolean OCI_API OCI_GetArrowSchema
 (
-    OCI_Resultset *rs,
-    const otext   *name
+    OCI_Resultset      *rs,
+    struct ArrowSchema *schema
 );
 
 /**
  * @brief
- * Return the statement handle associated with a resultset handle
+ * Fetch the next array of rows of the resultset as an Apache Arrow record batch
  *
- * @param rs - resultset handle
+ * @param rs    - Resultset handle
+ * @param array - Arrow C data interface array to fill
+ *
+ * @note
+ * The batch is made of the rows returned by OCI_FetchBatch() and is exported as a struct
+ * array matching the schema returned by OCI_GetArrowSchema(). Column values are converted
+ * directly from the internal fetch buffers into validity bitmaps and values buffers.
+ *
+ * @note
+ * The array owns its buffers and remains valid after further fetches. It must be released
+ * by calling its release callback once not needed anymore.
+ *
+ * @note
+ * Strings are exported in UTF-8. For ANSI builds, the client character set must be UTF-8.
+ *
+ * @note
+ * When no more rows are available, the array release callback is set to NULL.
+ *
+ * @return
+ * Number of rows of the batch or 0 if no more rows are available or on failure
  *
  */
 
-OCI_EXPORT OCI_Statement * OCI_API OCI_ResultsetGetStatement
+OCI_EXPORT unsigned int OCI_API OCI_FetchArrowBatch
 (
-    OCI_Resultset *rs
+    OCI_Resultset     *rs,
+    struct ArrowArray *array
 );
 
 /**
  * @brief
- * Return the current row data length of the column at the given index in the resultset
+ * Fetch all remaining rows of the resultset and write them to a file descriptor
+ * using the Apache Arrow IPC streaming format
  *
- * @param rs    - Resultset handle
- * @param index - Column position
+ * @param rs - Resultset handle
+ * @param fd - File descriptor opened for writing (file, pipe, socket)
  *
  * @note
- * Column position starts at 1.
+ * The stream is made of the schema message (see OCI_GetArrowSchema()), one record batch
+ * message per array of rows fetched (see OCI_FetchArrowBatch()) and the end of stream marker.
  *
  * @return
- * The column current row data length or 0 if index is out of bounds
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_GetDataLength
+OCI_EXPORT boolean OCI_API OCI_ExportArrowStream
 (
     OCI_Resultset *rs,
-    unsigned int   index
+    int            fd
 );
 
 /**
@@ -10050,6 +10842,219 @@ OCI_EXPORT unsigned int OCI_API OCI_GetFetchSize
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Set the memory budget used to size internal fetch arrays
+ *
+ * @param stmt - Statement handle
+ * @param size - Memory budget in bytes (0 to disable)
+ *
+ * @note
+ * When a budget is set, the number of rows fetched per internal fetch call is computed when
+ * the resultset is created, from the buffer size needed by a row (including an estimate for
+ * columns fetched into OCI descriptors or handles) :
+ * - The first fetch uses the value of OCI_GetFetchSize(). Each time an internal fetch call
+ *   fills the whole array of rows, the fetch size is doubled for the next call until it
+ *   reaches the budget
+ * - When the statement is re-executed, arrays start with the size needed by the rows
+ *   fetched by the previous execution, within the budget
+ * - When columns are fetched into OCI descriptors or handles or when pipelined fetch is
+ *   enabled, the budget is used right away
+ *
+ * @note
+ * Growing arrays reallocates the fetch buffers right before the next internal fetch call.
+ * Thus, buffers pointers returned by OCI_GetBatchData(), OCI_GetBatchIndicators() and
+ * OCI_GetString() for rows of the current array must not be used once OCI_FetchNext() or
+ * OCI_FetchBatch() moved past its last row.
+ * Handles returned by OCI_GetNumber() and OCI_GetDate() must be retrieved again after such
+ * a fetch and handles from a previous execution must not be used anymore.
+ *
+ * @note
+ * Unless it was changed with OCI_SetPrefetchSize(), the OCI prefetch size of the statement
+ * is also set from the budget for next executions.
+ * This setting is not applied to scrollable statements.
+ *
+ * @note
+ * Default value is 0 (fixed fetch size)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetFetchMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the memory budget used to size internal fetch arrays
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_SetFetchMemory() for details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetFetchMemory
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Enable or disable fetching the next array of rows in background
+ *
+ * @param stmt  - Statement handle
+ * @param value - Enable/disable pipelined fetch
+ *
+ * @note
+ * When enabled, each time an array of rows is fetched, the next one is requested from the
+ * server by a helper thread into a second set of buffers while the application consumes the
+ * current rows. Buffers are swapped when the current array is exhausted.
+ * It hides the network round trip of each internal fetch call for high latency connections.
+ *
+ * @note
+ * The value is applied on each statement execution, including re-executions of the same
+ * SQL statement. Rows fetched in background for a previous execution are discarded.
+ * Pipelined fetch is silently not used when:
+ * - OCILIB was not initialized with OCI_ENV_THREADED
+ * - the statement is scrollable or is a DML with a returning clause
+ * - a column is fetched into OCI descriptors or handles (lobs, files, timestamps,
+ *   intervals, cursors, objects, collections, references) or is a LONG
+ *
+ * @warning
+ * While a background fetch is running, other calls using the same connection wait for it
+ * to complete.
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetPipelinedFetch
+(
+    OCI_Statement *stmt,
+    boolean        value
+);
+
+/**
+ * @brief
+ * Return if the next array of rows is fetched in background
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_SetPipelinedFetch() for details
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetPipelinedFetch
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the maximum number of rows kept by the client side cache of scrollable resultsets
+ *
+ * @param stmt - Statement handle
+ * @param size - Number of rows (0 for no limit on rows)
+ *
+ * @note
+ * When a cache size or a cache memory budget (see OCI_SetFetchCacheMemory()) is set, each
+ * array of rows fetched from a scrollable resultset is kept in a client side cache.
+ * When OCI_FetchPrev(), OCI_FetchNext(), OCI_FetchFirst(), OCI_FetchLast() or OCI_FetchSeek()
+ * move to a row that belongs to a cached array, the rows are served from the cache without
+ * any server round trip. Once a limit is reached, the least recently used arrays are evicted.
+ *
+ * @note
+ * When moving backward to a row that is not cached, the array of rows ending with that row
+ * is fetched, so that paging backward also benefits from the cache.
+ *
+ * @note
+ * The value is applied to resultsets created by the next statement executions.
+ * The cache is silently not used when:
+ * - the statement is not scrollable (see OCI_SetFetchMode())
+ * - a column is fetched into OCI descriptors or handles (lobs, files, timestamps,
+ *   intervals, cursors, objects, collections, references) or is a LONG
+ *
+ * @note
+ * Default value is 0 (no cache unless a cache memory budget is set)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetFetchCacheSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the maximum number of rows kept by the client side cache of scrollable resultsets
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_SetFetchCacheSize() for details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetFetchCacheSize
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the memory budget of the client side cache of scrollable resultsets
+ *
+ * @param stmt - Statement handle
+ * @param size - Memory budget in bytes (0 for no limit on memory)
+ *
+ * @note
+ * See OCI_SetFetchCacheSize() for details
+ *
+ * @note
+ * Default value is 0 (no cache unless a cache size is set)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetFetchCacheMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the memory budget of the client side cache of scrollable resultsets
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_SetFetchCacheMemory() for details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetFetchCacheMemory
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Set the number of rows pre-fetched by OCI Client
@@ -10209,6 +11214,49 @@ OCI_EXPORT unsigned int OCI_API OCI_GetLongMode
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Set a callback that receives explicit LONG values piece by piece while rows are fetched
+ *
+ * @param stmt    - Statement handle
+ * @param handler - Pointer to a callback procedure or NULL to disable streaming
+ *
+ * @note
+ * When a handler is set, LONG and LONG RAW pieces are passed to the handler as soon as
+ * they are fetched instead of being accumulated in memory. Thus, the memory used for a
+ * LONG value never exceeds the size of a piece (see OCI_SetLongMaxSize()), whatever
+ * the size of the value.
+ *
+ * @note
+ * In streaming mode, the OCI_Long objects of fetched rows remain empty
+ *
+ * @note
+ * Only applies to statements using OCI_LONG_EXPLICIT mode
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetLongHandler
+(
+    OCI_Statement    *stmt,
+    POCI_LONG_HANDLER handler
+);
+
+/**
+ * @brief
+ * Return the LONG pieces streaming callback of a SQL statement
+ *
+ * @param stmt - Statement handle
+ *
+ */
+
+OCI_EXPORT POCI_LONG_HANDLER OCI_API OCI_GetLongHandler
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Return the connection handle associated with a statement handle
@@ -15252,16 +16300,18 @@ OCI_EXPORT boolean OCI_DescribeFmt
  * @par Internal conception
  *
  * - The hash table is composed of an array of slots.
- * - Each slot can hold a linked list of entries (one per key)
+ * - Each slot can hold one entry (one per key)
  * - Each entry can hold a linked list of values
  *
  * @note
- * - The internal hash function computes the index in the array where the entry
- *   has to be inserted/looked up.
- *
+ * - The internal hash function is case insensitive and computes the index in the array
+ *   where the entry has to be inserted/looked up.
+ * - The hash code of each entry key is stored in the table, keys being compared only
+ *   when hash codes match.
+ * - The array of slots is doubled when it is filled at 75%
  *
  * @note
- * Collisions are handled by chaining method.
+ * Collisions are handled by open addressing (linear probing).
  *
  * @include hash.c
  *
@@ -15275,6 +16325,9 @@ OCI_EXPORT boolean OCI_DescribeFmt
  * @param type     - type of the hash table
  *
  * @note
+ * The size is rounded up to the next power of 2, up to 2^30
+ *
+ * @note
  * Parameter can be one of the following values :
  *
  * - OCI_HASH_STRING  : string values
@@ -15314,6 +16367,9 @@ OCI_EXPORT boolean OCI_API OCI_HashFree
  *
  * @param table  - Table handle
  *
+ * @note
+ * The size grows with the number of entries
+ *
  */
 
 OCI_EXPORT unsigned int OCI_API OCI_HashGetSize
@@ -15506,6 +16562,9 @@ OCI_EXPORT OCI_HashValue * OCI_API OCI_HashGetValue
  * @warning
  * Index start at at
  *
+ * @note
+ * Each slot holds at most one entry, thus the returned entry next member is always NULL
+ *
  * @return
  * Slot handle otherwise NULL
  *
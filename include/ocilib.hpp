@@ -46,7 +46,10 @@
 #include <list>
 #include <vector>
 #include <iterator>
+#include <istream>
 #include <cstddef>
+#include <tuple>
+#include <exception>
 
 extern "C"{
 #include "ocilib.h"
@@ -549,6 +552,9 @@ class Exception : public std::exception
     template<class T>
     friend T Check(T result);
     friend class Statement;
+    friend class BindArray;
+    template<class...>
+    friend class BatchWriter;
 
 public:
 
@@ -682,6 +688,7 @@ class Environment
     friend class Pool;
     friend class Subscription;
     friend class Dequeue;
+    friend class Statement;
     template<class>
     friend class HandleHolder;
 
@@ -1306,6 +1313,7 @@ private:
     static unsigned int TAFHandler(OCI_Connection *pConnection, unsigned int type, unsigned int event);
     static void NotifyHandler(OCI_Event *pEvent);
     static void NotifyHandlerAQ(OCI_Dequeue *pDequeue);
+    static void LongHandler(OCI_Resultset *pResultset, unsigned int index, unsigned int row, const void *buffer, unsigned int size, boolean last);
 
     template<class T>
     static T GetUserCallback(AnyPointer ptr);
@@ -2394,6 +2402,40 @@ public:
      */
     void SetStatementCacheSize(unsigned int value);
 
+    /**
+     * @brief
+     * Return a prepared statement for the given SQL from the connection statement cache
+     *
+     * @param sql - SQL order or PL/SQL block
+     *
+     * @note
+     * An idle statement previously prepared with the same SQL is returned when available.
+     * Otherwise a new prepared statement is returned.
+     * The statement goes back into the cache once its last Statement object is destroyed.
+     *
+     * @note
+     * The statement is returned with default attributes and without binds nor resultsets.
+     * Host variables must be bound again before executing it.
+     *
+     */
+    Statement GetCachedStatement(const ostring& sql) const;
+
+    /**
+     * @brief
+     * Return the maximum number of idle statements kept by GetCachedStatement()
+     *
+     */
+    unsigned int GetCachedStatementLimit() const;
+
+    /**
+     * @brief
+     * Set the maximum number of idle statements kept by GetCachedStatement()
+     *
+     * @param value - maximum number of idle statements (0 disables the cache)
+     *
+     */
+    void SetCachedStatementLimit(unsigned int value);
+
     /**
      * @brief
      * Return the default LOB prefetch buffer size for the connection
@@ -5695,6 +5737,23 @@ public:
     */
     BindDirection GetDirection() const;
 
+    /**
+    * @brief
+    * Mark the bind host variable as modified
+    *
+    * @note
+    * Only meaningful when bind tracking is enabled (see Statement::EnableBindTracking())
+    *
+    */
+    void SetDirty();
+
+    /**
+    * @brief
+    * Indicate if the bind has been modified since the last statement execution
+    *
+    */
+    bool IsDirty() const;
+
 private:
 
     BindInfo(OCI_Bind *pBind, Handle *parent);
@@ -5710,6 +5769,7 @@ private:
 class Statement : public HandleHolder<OCI_Statement *>
 {
     friend class Exception;
+    friend class Connection;
     friend class Resultset;
     template<class, int>
     friend class Long;
@@ -5824,6 +5884,22 @@ public:
     */
     typedef Enum<LongModeValues> LongMode;
 
+    /**
+    * @typedef LongHandlerProc
+    *
+    * @brief
+    * User callback receiving LONG values piece by piece
+    *
+    * @note
+    * For LONG columns, the stream holds ocilib::otext characters.
+    * For LONG RAW columns, it holds raw bytes.
+    *
+    * @warning
+    * The stream is only valid during the callback call
+    *
+    */
+    typedef void(*LongHandlerProc) (const Resultset &resultset, unsigned int index, unsigned int row, std::istream &piece, bool last);
+
     /**
     * @brief
     * Create an empty null Statement instance
@@ -6118,6 +6194,44 @@ public:
     */
     unsigned int GetBindArraySize() const;
 
+    /**
+    * @brief
+    * Set the maximum number of array DML iterations sent to the server in a single round trip
+    *
+    * @param size - maximum number of iterations per execution (0 for no limit)
+    *
+    * @note
+    * See OCI_BindArraySetChunkSize() for details
+    *
+    */
+    void SetBindArrayChunkSize(unsigned int size);
+
+    /**
+    * @brief
+    * Return the maximum number of array DML iterations sent to the server in a single round trip
+    *
+    */
+    unsigned int GetBindArrayChunkSize() const;
+
+    /**
+    * @brief
+    * Set the memory budget of bind array data sent to the server in a single round trip
+    *
+    * @param size - maximum size in bytes (0 for no limit)
+    *
+    * @note
+    * See OCI_BindArraySetChunkMemory() for details
+    *
+    */
+    void SetBindArrayChunkMemory(unsigned int size);
+
+    /**
+    * @brief
+    * Return the memory budget of bind array data sent to the server in a single round trip
+    *
+    */
+    unsigned int GetBindArrayChunkMemory() const;
+
     /**
     * @brief
     * Allow different host variables to be binded using the same bind name or
@@ -6145,6 +6259,43 @@ public:
     */
     bool IsRebindingAllowed() const;
 
+    /**
+    * @brief
+    * Only process binds modified since the last execution of the statement
+    *
+    * @param value - Enable or disable bind tracking
+    *
+    * @note
+    * Default value is false
+    *
+    * @note
+    * Binds are marked as modified when binded, when their null state, size or direction is changed,
+    * or explicitly with BindInfo::SetDirty().
+    * Binds using an intermediate buffer (strings, vectors, ...) are marked as modified when their content
+    * differs from the one of the previous execution.
+    * Vectors bound in place are read directly by OCI at each execution, except vectors of big_int and
+    * big_uint that are always marked as modified.
+    *
+    * @warning
+    * BindInfo::SetDirty() must be called after modifying the value of bound objects such as
+    * Date, Number, Timestamp, Lob, ... or big_int host variables
+    *
+    * @note
+    * See OCI_EnableBindTracking() for more details
+    *
+    */
+    void EnableBindTracking(bool value);
+
+    /**
+    * @brief
+    * Indicate if bind tracking is enabled on the statement
+    *
+    * @note
+    * See EnableBindTracking() for more details
+    *
+    */
+    bool IsBindTrackingEnabled() const;
+
     /**
     * @brief
     * Return the index of the bind from its name belonging to the statement
@@ -6277,6 +6428,11 @@ public:
     * It is not necessary to specify the template data type in the bind call as all possible specializations can be resolved
     * automatically from the arguments.
     *
+    * @note
+    * Vectors of native numeric types (short, int, big_int, double, ...) that already hold all the array elements
+    * when binding are bound in place, without intermediate buffer and copies.
+    * Such vectors must not be resized until the statement is executed, otherwise an exception is raised on execution.
+    *
     */
     template<class T>
     void Bind(const ostring& name, std::vector<T> &values, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray);
@@ -6488,6 +6644,85 @@ public:
     */
     unsigned int GetFetchSize() const;
 
+    /**
+    * @brief
+    * Set the memory budget used to size internal fetch arrays
+    *
+    * @param value - Memory budget in bytes (0 to disable)
+    *
+    * @note
+    * See OCI_SetFetchMemory() for details
+    *
+    */
+    void SetFetchMemory(unsigned int value);
+
+    /**
+    * @brief
+    * Return the memory budget used to size internal fetch arrays
+    *
+    */
+    unsigned int GetFetchMemory() const;
+
+    /**
+    * @brief
+    * Enable or disable fetching the next array of rows in background
+    *
+    * @param value - Enable/disable pipelined fetch
+    *
+    * @note
+    * See OCI_SetPipelinedFetch() for details
+    *
+    * @note
+    * Default value is false
+    *
+    */
+    void SetPipelinedFetch(bool value);
+
+    /**
+    * @brief
+    * Return if the next array of rows is fetched in background
+    *
+    */
+    bool GetPipelinedFetch() const;
+
+    /**
+    * @brief
+    * Set the maximum number of rows kept by the client side cache of scrollable resultsets
+    *
+    * @param value - Number of rows (0 for no limit on rows)
+    *
+    * @note
+    * See OCI_SetFetchCacheSize() for details
+    *
+    */
+    void SetFetchCacheSize(unsigned int value);
+
+    /**
+    * @brief
+    * Return the maximum number of rows kept by the client side cache of scrollable resultsets
+    *
+    */
+    unsigned int GetFetchCacheSize() const;
+
+    /**
+    * @brief
+    * Set the memory budget of the client side cache of scrollable resultsets
+    *
+    * @param value - Memory budget in bytes (0 for no limit on memory)
+    *
+    * @note
+    * See OCI_SetFetchCacheSize() for details
+    *
+    */
+    void SetFetchCacheMemory(unsigned int value);
+
+    /**
+    * @brief
+    * Return the memory budget of the client side cache of scrollable resultsets
+    *
+    */
+    unsigned int GetFetchCacheMemory() const;
+
     /**
     * @brief
     * Set the number of rows pre-fetched by OCI Client
@@ -6578,6 +6813,20 @@ public:
     */
     LongMode GetLongMode() const;
 
+    /**
+    * @brief
+    * Set a handler receiving LONG values piece by piece while rows are fetched
+    *
+    * @param handler - LONG pieces handler procedure or nullptr to disable streaming
+    *
+    * @note
+    * In streaming mode, LONG values are never fully buffered in memory and the
+    * ocilib::Long objects of fetched rows remain empty.
+    * See LongHandlerProc documentation for more details
+    *
+    */
+    void SetLongHandler(LongHandlerProc handler);
+
     /**
     * @brief
     * Return the Oracle SQL code the command held by the statement
@@ -6651,142 +6900,497 @@ private:
 
 /**
  * @brief
- * Database resultset
+ * Buffered writer of rows into a prepared DML statement using array execution
  *
- * This class wraps the OCILIB object handle OCI_Resultset and its related methods
+ * Rows are added one by one with Add() and stored column-wise into native buffers that are
+ * directly bound to the statement. Rows are sent to the server using a single array execution
+ * once a row count or a byte size threshold is reached, or on explicit Flush() calls.
+ *
+ * @tparam T - C++ types of the bind variables in the order given at construction
+ *
+ * Supported types are:
+ *  - short, unsigned short, int, unsigned int, big_int, big_uint, float, double
+ *  - ostring (strings buffers grow on demand, empty strings are inserted as NULL)
+ *  - Date (null Date objects are not supported)
+ *
+ * Rows rejected by the server do not interrupt the batch. They are reported by GetErrors()
+ * with the exception raised for the row, the row values and the row position.
+ *
+ * When the background mode is enabled, flushes are performed by a worker thread while the
+ * next rows are stored into a second set of buffers. This mode requires the environment to be
+ * initialized with Environment::Threaded.
+ *
+ * @note
+ * The statement must be prepared before creating the writer and must not be used by the
+ * program until the writer is destroyed. Rebinding is enabled on the statement.
+ * As the statement binds point to the writer buffers, the writer prepares the statement again
+ * with the same SQL on destruction. Its binds are thus released and it must be bound again
+ * before being executed.
+ *
+ * @warning
+ * Pending rows are flushed on destruction but errors occurring at that time are ignored.
+ * Call Flush() before destroying the writer to get notified of failures.
  *
  */
-class Resultset : public HandleHolder<OCI_Resultset *>
+template<class... T>
+class BatchWriter
 {
-    friend class Statement;
 public:
 
     /**
+    * @typedef Row
+    *
     * @brief
-    * Seek Modes enumerated values
+    * Tuple holding the values of a row
     *
     */
-    enum SeekModeValues
-    {
-        /** Seek is performed using a given absolute offset. The statement must be scrollable */
-        SeekAbsolute = OCI_SFD_ABSOLUTE,
-        /** Seek is performed using a given relative offset from the current position. The statement must be scrollable */
-        SeekRelative = OCI_SFD_RELATIVE
-    };
+    typedef std::tuple<T...> Row;
 
     /**
     * @brief
-    * Seek Modes
-    *
-    * Possible values are Resultset::SeekModeValues
+    * Row rejected by the server
     *
     */
-    typedef Enum<SeekModeValues> SeekMode;
+    class Error
+    {
+        friend class BatchWriter;
+
+    public:
+
+        /**
+        * @brief
+        * Return the exception raised for the row
+        *
+        * @note
+        * Exception::GetRow() returns the row position in the flushed batch
+        *
+        */
+        const Exception& GetException() const;
+
+        /**
+        * @brief
+        * Return the values of the row
+        *
+        */
+        const Row& GetRow() const;
+
+        /**
+        * @brief
+        * Return the position of the row among all rows added to the writer
+        *
+        * @note
+        * Row position starts at 0.
+        *
+        */
+        big_uint GetIndex() const;
+
+    private:
+
+        Error(const Exception &exception, const Row &row, big_uint index);
+
+        Exception _exception;
+        Row _row;
+        big_uint _index;
+    };
 
     /**
     * @brief
-    * Return the current value of the column at the given index in the resultset
+    * Create a writer on the given statement
     *
-    * @tparam T - C++ type of the value to retrieve
+    * @param statement  - Prepared DML statement
+    * @param names      - Names of the bind variables matching the row values
+    * @param maxRows    - Maximum number of rows sent at once
+    * @param maxBytes   - Size in bytes of the row values triggering a flush (0 for no limit)
+    * @param background - Perform flushes in a worker thread
     *
-    * @param index - Column position
+    * @note
+    * maxRows is the size of the bind arrays allocated by the writer.
     *
     * @note
-    * Column position starts at 1.
+    * An exception is thrown if the number of names does not match the number of row values.
     *
     */
-    template<class T>
-    T Get(unsigned int index) const;
+    BatchWriter(const Statement &statement, const std::vector<ostring> &names, unsigned int maxRows,
+                unsigned int maxBytes = 0, bool background = false);
 
     /**
     * @brief
-    * Assign to the current value of the column at the given index in the resultset
-    *
-    * @tparam T - C++ type of the value to retrieve
-    *
-    * @param index - Column position
-    * @param value - value to fill
+    * Flush pending rows, release the statement binds and the writer buffers
     *
     * @note
-    * Column position starts at 1.
+    * The statement is prepared again with the same SQL, see the class description
     *
     */
-    template<class T>
-    void Get(unsigned int index, T &value) const;
+    ~BatchWriter() noexcept;
 
     /**
     * @brief
-    * Return the current value of the column from its name in the resultset
-    *
-    * @tparam T - C++ type of the value to retrieve
+    * Add a row to the writer
     *
-    * @param name  - Column name
+    * @param values - Row values
     *
     * @note
-    * The column name is case insensitive.
+    * The pending rows are flushed when the row or byte threshold is reached.
     *
     */
-    template<class T>
-    T Get(const ostring& name) const;
+    void Add(const T&... values);
 
     /**
     * @brief
-    * Assign to the current value of the column from its name in the resultset
-    *
-    * @tparam T - C++ type of the value to retrieve
+    * Send all pending rows to the server and wait for the completion of background flushes
     *
-    * @param name - Column name
-    * @param value - value to fill
+    * @note
+    * Errors raised by background flushes are thrown by the next call to Add() or Flush()
     *
     */
-    template<class T>
-    void Get(const ostring &name, T &value) const;
+    void Flush();
 
     /**
     * @brief
-    * Return a given user type from the current fetched row.
-    * It allow translating row column values returned by a query to a user defined type using the given adapter type
+    * Return the number of rows added to the writer
     *
-     * @param value    - User defined type value to be filled by the adapter function
-    * @param adapter -  User defined adapter function
+    */
+    big_uint GetRowCount() const;
+
+    /**
+    * @brief
+    * Return the number of rows successfully processed by the server
     *
     * @note
-    * The user defined adapter function must conform to the following prototype:
-    * bool adapter (const Resultset &, T &)
-    * It shall return true if it has filled the value from the resultset otherwise false
+    * Background flushes are only accounted once completed (see Flush())
     *
     */
-    template<class T, class U>
-    bool Get(T& value, U adapter) const;
+    big_uint GetAffectedRows() const;
 
     /**
     * @brief
-    * Fetch all rows in the resultset and call the given callback for row
-    *
-    * @param callback -  User defined callback
+    * Return the rows rejected by the server
     *
     * @note
-    * The user defined callback function must conform to the following prototype:
-    * bool callback(const Resultset &)
-    * It shall return true to continue fetching the resultset or false to stop the fetch
-    *
-    * @return
-    * The number of rows fetched
+    * Background flushes are only accounted once completed (see Flush())
     *
     */
-    template<typename T>
-    unsigned int ForEach(T callback);
+    const std::vector<Error>& GetErrors() const;
 
     /**
     * @brief
-    * Fetch all rows in the resultset and call the given callback for row
-    * It allow translating row column values returned by a query to a user defined type using the given adapter type
-    *
-    * @param callback -  User defined callback
-    * @param adapter  -  User defined adapter function
+    * Clear the list of rejected rows
     *
-     * @note
-    * The user defined adapter function must conform to the following prototype:
+    */
+    void ClearErrors();
+
+private:
+
+    typedef std::tuple<BatchColumn<T>...> Columns;
+
+    BatchWriter(const BatchWriter &other);
+    BatchWriter& operator = (const BatchWriter &other);
+
+    static void FlushProc(ThreadHandle handle, AnyPointer arg);
+
+    void Dispatch();
+    void Wait();
+    void ReleaseBinds() noexcept;
+    void Execute(unsigned int buffer, unsigned int count, big_uint offset, big_uint &affectedRows, std::vector<Error> &errors);
+
+    template<std::size_t N>
+    unsigned int SetValues(Columns &columns, unsigned int index);
+
+    template<std::size_t N, class V, class... R>
+    unsigned int SetValues(Columns &columns, unsigned int index, const V &value, const R&... others);
+
+    Statement _statement;
+    std::vector<ostring> _names;
+    unsigned int _maxRows;
+    unsigned int _maxBytes;
+    bool _background;
+
+    Columns _columns[2];
+    unsigned int _buffer;
+    unsigned int _count;
+    unsigned int _bytes;
+    int _bound;
+
+    ThreadHandle _thread;
+    bool _running;
+    unsigned int _flushBuffer;
+    unsigned int _flushCount;
+    big_uint _flushOffset;
+    big_uint _flushAffectedRows;
+    std::vector<Error> _flushErrors;
+    std::exception_ptr _failure;
+
+    big_uint _rowCount;
+    big_uint _affectedRows;
+    std::vector<Error> _errors;
+};
+
+/**
+ * @brief
+ * Non owning view on a string value of a resultset
+ *
+ * Instances are returned by Resultset::Get<StringView>() and refer to the resultset
+ * internal buffers without any allocation or copy.
+ *
+ * @warning
+ * A view on a character column is only valid until the next fetch call on the resultset.
+ * For other column types, the view refers to the resultset conversion buffer that is
+ * overwritten by the next string retrieval on the resultset.
+ *
+ */
+class StringView
+{
+public:
+
+    /**
+    * @brief
+    * Character type
+    *
+    */
+    typedef otext value_type;
+
+    /**
+    * @brief
+    * Size type
+    *
+    */
+    typedef size_t size_type;
+
+    /**
+    * @brief
+    * Iterator type
+    *
+    */
+    typedef const otext * const_iterator;
+
+    /**
+    * @brief
+    * Create an empty view
+    *
+    */
+    StringView();
+
+    /**
+    * @brief
+    * Create a view on the given characters
+    *
+    * @param data - Pointer to the first character
+    * @param size - Number of characters
+    *
+    */
+    StringView(const otext *data, size_type size);
+
+    /**
+    * @brief
+    * Return the pointer to the first character (NULL for an empty view on a null value)
+    *
+    */
+    const otext * data() const;
+
+    /**
+    * @brief
+    * Return the number of characters
+    *
+    */
+    size_type size() const;
+
+    /**
+    * @brief
+    * Return the number of characters
+    *
+    */
+    size_type length() const;
+
+    /**
+    * @brief
+    * Return true if the view has no characters
+    *
+    */
+    bool empty() const;
+
+    /**
+    * @brief
+    * Return an iterator on the first character
+    *
+    */
+    const_iterator begin() const;
+
+    /**
+    * @brief
+    * Return an iterator past the last character
+    *
+    */
+    const_iterator end() const;
+
+    /**
+    * @brief
+    * Return the character at the given position
+    *
+    */
+    otext operator [] (size_type index) const;
+
+    /**
+    * @brief
+    * Return a string holding a copy of the characters
+    *
+    */
+    ostring ToString() const;
+
+    /**
+    * @brief
+    * Return a string holding a copy of the characters
+    *
+    */
+    operator ostring() const;
+
+private:
+
+    const otext *_data;
+    size_type _size;
+};
+
+/**
+ * @brief
+ * Database resultset
+ *
+ * This class wraps the OCILIB object handle OCI_Resultset and its related methods
+ *
+ */
+class Resultset : public HandleHolder<OCI_Resultset *>
+{
+    friend class Statement;
+    friend class Environment;
+public:
+
+    /**
+    * @brief
+    * Seek Modes enumerated values
+    *
+    */
+    enum SeekModeValues
+    {
+        /** Seek is performed using a given absolute offset. The statement must be scrollable */
+        SeekAbsolute = OCI_SFD_ABSOLUTE,
+        /** Seek is performed using a given relative offset from the current position. The statement must be scrollable */
+        SeekRelative = OCI_SFD_RELATIVE
+    };
+
+    /**
+    * @brief
+    * Seek Modes
+    *
+    * Possible values are Resultset::SeekModeValues
+    *
+    */
+    typedef Enum<SeekModeValues> SeekMode;
+
+    /**
+    * @brief
+    * Return the current value of the column at the given index in the resultset
+    *
+    * @tparam T - C++ type of the value to retrieve
+    *
+    * @param index - Column position
+    *
+    * @note
+    * Column position starts at 1.
+    *
+    */
+    template<class T>
+    T Get(unsigned int index) const;
+
+    /**
+    * @brief
+    * Assign to the current value of the column at the given index in the resultset
+    *
+    * @tparam T - C++ type of the value to retrieve
+    *
+    * @param index - Column position
+    * @param value - value to fill
+    *
+    * @note
+    * Column position starts at 1.
+    *
+    * @note
+    * For ostring values, the given string capacity is reused
+    *
+    */
+    template<class T>
+    void Get(unsigned int index, T &value) const;
+
+    /**
+    * @brief
+    * Return the current value of the column from its name in the resultset
+    *
+    * @tparam T - C++ type of the value to retrieve
+    *
+    * @param name  - Column name
+    *
+    * @note
+    * The column name is case insensitive.
+    *
+    */
+    template<class T>
+    T Get(const ostring& name) const;
+
+    /**
+    * @brief
+    * Assign to the current value of the column from its name in the resultset
+    *
+    * @tparam T - C++ type of the value to retrieve
+    *
+    * @param name - Column name
+    * @param value - value to fill
+    *
+    */
+    template<class T>
+    void Get(const ostring &name, T &value) const;
+
+    /**
+    * @brief
+    * Return a given user type from the current fetched row.
+    * It allow translating row column values returned by a query to a user defined type using the given adapter type
+    *
+     * @param value    - User defined type value to be filled by the adapter function
+    * @param adapter -  User defined adapter function
+    *
+    * @note
+    * The user defined adapter function must conform to the following prototype:
+    * bool adapter (const Resultset &, T &)
+    * It shall return true if it has filled the value from the resultset otherwise false
+    *
+    */
+    template<class T, class U>
+    bool Get(T& value, U adapter) const;
+
+    /**
+    * @brief
+    * Fetch all rows in the resultset and call the given callback for row
+    *
+    * @param callback -  User defined callback
+    *
+    * @note
+    * The user defined callback function must conform to the following prototype:
+    * bool callback(const Resultset &)
+    * It shall return true to continue fetching the resultset or false to stop the fetch
+    *
+    * @return
+    * The number of rows fetched
+    *
+    */
+    template<typename T>
+    unsigned int ForEach(T callback);
+
+    /**
+    * @brief
+    * Fetch all rows in the resultset and call the given callback for row
+    * It allow translating row column values returned by a query to a user defined type using the given adapter type
+    *
+    * @param callback -  User defined callback
+    * @param adapter  -  User defined adapter function
+    *
+     * @note
+    * The user defined adapter function must conform to the following prototype:
     * [UserDefinedType] adapter (const Resultset &)
     * The return value type must match the parameter of the callback method
     *
@@ -6802,6 +7406,68 @@ public:
     template<typename T, typename U>
     unsigned int ForEach(T callback, U adapter);
 
+    /**
+    * @brief
+    * Fetch all rows in the resultset and call the given callback with each row as a typed tuple
+    *
+    * @tparam T - std::tuple type describing the row (e.g. std::tuple<int, ostring, Date>)
+    *
+    * @param callback -  User defined callback
+    *
+    * @note
+    * Tuple elements are mapped to the columns in their order, starting from the first column.
+    * Column types are checked once against the tuple element types before fetching.
+    * An exception is raised if a column does not exist or does not match its tuple element type.
+    *
+    * @note
+    * Rows are still fetched one by one with Next() and each tuple element is retrieved
+    * like with Get(), at the cost of one library call and one error check per value.
+    * Only the column type checks and name lookups are saved. For large resultsets of
+    * numeric values, NextBatch() retrieves whole columns of an array of rows at once.
+    *
+    * @note
+    * The user defined callback function must conform to the following prototype:
+    * bool callback(const T &)
+    * It shall return true to continue fetching the resultset or false to stop the fetch
+    *
+    * @return
+    * The number of rows fetched
+    *
+    */
+    template<class T, class U>
+    unsigned int ForEachAs(U callback);
+
+    /**
+    * @brief
+    * Fetch all rows in the resultset and call the given callback with each row as a typed tuple
+    *
+    * @tparam T - std::tuple type describing the row (e.g. std::tuple<int, ostring, Date>)
+    *
+    * @param names    -  Names of the columns mapped to the tuple elements
+    * @param callback -  User defined callback
+    *
+    * @note
+    * Column names are resolved and column types are checked once before fetching.
+    * An exception is raised if a column does not exist or does not match its tuple element type.
+    *
+    * @note
+    * Rows are still fetched one by one with Next() and each tuple element is retrieved
+    * like with Get(), at the cost of one library call and one error check per value.
+    * Only the column type checks and name lookups are saved. For large resultsets of
+    * numeric values, NextBatch() retrieves whole columns of an array of rows at once.
+    *
+    * @note
+    * The user defined callback function must conform to the following prototype:
+    * bool callback(const T &)
+    * It shall return true to continue fetching the resultset or false to stop the fetch
+    *
+    * @return
+    * The number of rows fetched
+    *
+    */
+    template<class T, class U>
+    unsigned int ForEachAs(const std::vector<ostring> &names, U callback);
+
     /**
     * @brief
     * Fetch the next row of the resultset
@@ -6817,6 +7483,64 @@ public:
     */
     bool Next();
 
+    /**
+    * @brief
+    * Fetch the next array of rows of the resultset as a single columnar batch
+    *
+    * @note
+    * The batch gives direct access to the internal column buffers of the fetched rows.
+    * It is only valid until the next fetch call on the resultset.
+    *
+    * @note
+    * Batch size is bounded by the statement fetch size (see Statement::SetFetchSize()).
+    *
+    * @return
+    * The fetched batch. Its row count is 0 if the resultset is empty or all rows have been fetched
+    *
+    */
+    ColumnBatch NextBatch();
+
+    /**
+    * @brief
+    * Describe the resultset columns as an Apache Arrow struct schema
+    *
+    * @param schema - Arrow C data interface schema to fill
+    *
+    * @note
+    * See OCI_GetArrowSchema() for the mapping of column types to Arrow types.
+    *
+    * @note
+    * The schema must be released by calling its release callback once not needed anymore.
+    *
+    */
+    void GetArrowSchema(struct ArrowSchema &schema) const;
+
+    /**
+    * @brief
+    * Fetch the next array of rows of the resultset as an Apache Arrow record batch
+    *
+    * @param array - Arrow C data interface array to fill
+    *
+    * @note
+    * The array owns its buffers and remains valid after further fetches.
+    * It must be released by calling its release callback once not needed anymore.
+    *
+    * @return
+    * The number of rows of the batch or 0 if all rows have been fetched
+    *
+    */
+    unsigned int NextArrowBatch(struct ArrowArray &array);
+
+    /**
+    * @brief
+    * Fetch all remaining rows of the resultset and write them to the given file descriptor
+    * using the Apache Arrow IPC streaming format
+    *
+    * @param fd - File descriptor opened for writing
+    *
+    */
+    void ExportArrowStream(int fd);
+
     /**
     * @brief
     * Fetch the previous row of the resultset
@@ -7006,6 +7730,126 @@ public:
 private:
 
    Resultset(OCI_Resultset *resultset, Handle *parent);
+
+   template<class T, class U>
+   unsigned int FetchAs(const std::vector<unsigned int> &indexes, U callback);
+};
+
+/**
+ * @brief
+ * Columnar view on a batch of rows fetched at once from a resultset
+ *
+ * Instances are returned by Resultset::NextBatch() and provide direct access to the resultset
+ * internal column buffers for processing whole columns in tight loops.
+ *
+ * @warning
+ * A batch is only valid until the next fetch call on the resultset it was fetched from.
+ *
+ * @note
+ * Only columns of the following types are supported: numerics, strings, raws, dates and booleans
+ *
+ */
+class ColumnBatch
+{
+    friend class Resultset;
+
+public:
+
+    /**
+    * @brief
+    * Return the number of rows of the batch
+    *
+    */
+    unsigned int GetCount() const;
+
+    /**
+    * @brief
+    * Return the resultset the batch was fetched from
+    *
+    */
+    Resultset GetResultset() const;
+
+    /**
+    * @brief
+    * Return the data vector of the column at the given index
+    *
+    * @param index  - Column position
+    * @param stride - size in bytes of a row value in the vector
+    *
+    * @note
+    * Column position starts at 1.
+    *
+    * @note
+    * Values are stored using the internal column buffer format (see OCI_GetBatchData())
+    *
+    */
+    const void * GetData(unsigned int index, unsigned int &stride) const;
+
+    /**
+    * @brief
+    * Return the null indicator vector of the column at the given index
+    *
+    * @param index - Column position
+    *
+    * @note
+    * Column position starts at 1.
+    *
+    * @note
+    * A row value is null if its indicator is equal to -1
+    *
+    */
+    const short * GetIndicators(unsigned int index) const;
+
+    /**
+    * @brief
+    * Return the data length vector (in bytes) of the column at the given index
+    *
+    * @param index - Column position
+    *
+    * @note
+    * Column position starts at 1.
+    *
+    */
+    const unsigned short * GetLengths(unsigned int index) const;
+
+    /**
+    * @brief
+    * Check if the value of the column at the given index is null for the given row
+    *
+    * @param index - Column position
+    * @param row   - Row position in the batch
+    *
+    * @note
+    * Column position starts at 1 and row position starts at 0.
+    *
+    */
+    bool IsNull(unsigned int index, unsigned int row) const;
+
+    /**
+    * @brief
+    * Fill the given vector with the values of the numeric column at the given index
+    *
+    * @tparam T - native numeric type (short, int, big_int, double, ...)
+    *
+    * @param index  - Column position
+    * @param values - vector to fill
+    *
+    * @note
+    * Column position starts at 1.
+    *
+    * @note
+    * The vector is resized to the number of rows of the batch. Null values are set to 0.
+    *
+    */
+    template<class T>
+    void GetNumbers(unsigned int index, std::vector<T> &values) const;
+
+private:
+
+    ColumnBatch(const Resultset &resultset, unsigned int count);
+
+    Resultset _resultset;
+    unsigned int _count;
 };
 
 /**
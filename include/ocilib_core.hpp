@@ -41,6 +41,7 @@
 #pragma once
 
 #include <map>
+#include <streambuf>
 
 namespace ocilib
 {
@@ -97,6 +98,9 @@ namespace ocilib
 
 #endif
 
+#if (__cplusplus >= CPP_11) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+    #define HAS_THREAD_LOCAL
+#endif
 
 #define ARG_NOT_USED(a) (a) = (a)
 
@@ -108,6 +112,8 @@ class Transaction;
 class Environment;
 class Statement;
 class Resultset;
+class StringView;
+class ColumnBatch;
 class Date;
 class Timestamp;
 class Interval;
@@ -162,6 +168,12 @@ struct SupportedNumeric
 */
 template<class T> struct BindResolver {};
 
+/**
+* @brief Internal usage.
+* Native array storage of a C++ type used by BatchWriter
+*/
+template<class T> class BatchColumn;
+
 /**
  * @brief Internal usage.
  * Checks if the last OCILIB function call has raised an error.
@@ -170,6 +182,12 @@ template<class T> struct BindResolver {};
 template<class T>
 static T Check(T result);
 
+/**
+ * @brief Internal usage.
+ * Returns the address of the calling thread error pending flag maintained by the C API
+ */
+const boolean * GetLastErrorFlag();
+
 /**
  * @brief Internal usage.
  * Constructs a C++ string object from the given OCILIB string pointer
@@ -286,6 +304,16 @@ private:
     size_t _size;
 };
 
+/**
+* @brief
+* Read only stream buffer over an existing memory block
+*/
+class MemoryStreamBuffer : public std::streambuf
+{
+public:
+    MemoryStreamBuffer(const void *data, size_t size);
+};
+
 class Locker
 {
 public:
@@ -495,7 +523,12 @@ public:
 
     unsigned int GetMode() const;
 
-    virtual void SetInData()  = 0;
+    OCI_Bind * GetBind() const;
+    void SetBind(OCI_Bind *bind);
+
+    /* returns true when the bind buffer has been modified */
+
+    virtual bool SetInData()  = 0;
     virtual void SetOutData() = 0;
 
 protected:
@@ -503,6 +536,7 @@ protected:
     const Statement& _statement;
     ostring _name;
     unsigned int _mode;
+    OCI_Bind *_bind;
 };
 
 class BindArray : public BindObject
@@ -518,7 +552,7 @@ public:
      template<class T>
      typename BindResolver<T>::OutputType * GetData() const;
 
-     void SetInData() override;
+     bool SetInData() override;
      void SetOutData() override;
 
      unsigned int GetSize() const;
@@ -530,12 +564,13 @@ private:
     {
     public:
         virtual ~AbstractBindArrayObject() {};
-        virtual void SetInData() = 0;
-        virtual void SetOutData() = 0;
+        virtual bool SetInData(OCI_Bind *bind) = 0;
+        virtual void SetOutData(OCI_Bind *bind) = 0;
         virtual ostring GetName() const = 0;
         virtual bool IsHandleObject() const = 0;
         virtual unsigned int GetSize() const = 0;
         virtual unsigned int GetSizeForBindCall() const = 0;
+        virtual void CheckData() const = 0;
     };
 
     template<class T>
@@ -549,12 +584,13 @@ private:
 
         BindArrayObject(const Statement &statement, const ostring &name, ObjectVector &vector, bool isPlSqlTable, unsigned int mode, unsigned int elemSize);
         virtual ~BindArrayObject() noexcept;
-        void SetInData() override;
-        void SetOutData() override;
+        bool SetInData(OCI_Bind *bind) override;
+        void SetOutData(OCI_Bind *bind) override;
         ostring GetName()const  override;
         bool IsHandleObject() const override;
         unsigned int GetSize() const override;
         unsigned int GetSizeForBindCall() const override;
+        void CheckData() const override;
 
         operator ObjectVector & () const;
         operator NativeType * () const;
@@ -564,6 +600,11 @@ private:
         void AllocData();
         void FreeData() const;
 
+        static NativeType * GetVectorData(std::vector<NativeType> &vector);
+
+        template<class U>
+        static NativeType * GetVectorData(std::vector<U> &vector);
+
         const Statement& _statement;
         ostring _name;
         ObjectVector& _vector;
@@ -572,8 +613,11 @@ private:
         unsigned int _mode;
         unsigned int _elemCount;
         unsigned int _elemSize;
+        bool _direct;
     };
 
+    static void ThrowVectorResized(const Statement &statement, const ostring &name);
+
     AbstractBindArrayObject * _object;
 };
 
@@ -589,7 +633,7 @@ public:
 
     operator NativeType *()  const;
 
-    void SetInData() override;
+    bool SetInData() override;
     void SetOutData() override;
 
     BindObjectAdaptor(const Statement &statement, const ostring& name, unsigned int mode, ObjectType &object, unsigned int size);
@@ -614,7 +658,7 @@ public:
 
     operator NativeType *()  const;
 
-    void SetInData() override;
+    bool SetInData() override;
     void SetOutData() override;
 
     BindTypeAdaptor(const Statement &statement, const ostring& name, unsigned int mode, ObjectType &object);
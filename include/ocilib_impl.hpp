@@ -159,14 +159,347 @@ template<> struct NumericTypeResolver<big_uint>       { enum { Value = NumericUn
 template<> struct NumericTypeResolver<double>         { enum { Value = NumericDouble }; };
 template<> struct NumericTypeResolver<float>          { enum { Value = NumericFloat }; };
 
+/**
+* @brief Allow resolving the column data type matching a C++ type when fetching typed rows
+*/
+template<class T> struct ColumnTypeResolver{};
+
+template<> struct ColumnTypeResolver<short>          { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<unsigned short> { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<int>            { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<unsigned int>   { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<big_int>        { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<big_uint>       { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<float>          { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<double>         { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<Number>         { enum { Value = TypeNumeric }; };
+template<> struct ColumnTypeResolver<ostring>        { enum { Value = TypeString }; };
+template<> struct ColumnTypeResolver<StringView>     { enum { Value = TypeString }; };
+template<> struct ColumnTypeResolver<Raw>            { enum { Value = TypeRaw }; };
+template<> struct ColumnTypeResolver<Date>           { enum { Value = TypeDate }; };
+template<> struct ColumnTypeResolver<Timestamp>      { enum { Value = TypeTimestamp }; };
+template<> struct ColumnTypeResolver<Interval>       { enum { Value = TypeInterval }; };
+template<> struct ColumnTypeResolver<Clob>           { enum { Value = TypeLob }; };
+template<> struct ColumnTypeResolver<NClob>          { enum { Value = TypeLob }; };
+template<> struct ColumnTypeResolver<Blob>           { enum { Value = TypeLob }; };
+template<> struct ColumnTypeResolver<File>           { enum { Value = TypeFile }; };
+template<> struct ColumnTypeResolver<Clong>          { enum { Value = TypeLong }; };
+template<> struct ColumnTypeResolver<Blong>          { enum { Value = TypeLong }; };
+template<> struct ColumnTypeResolver<Reference>      { enum { Value = TypeReference }; };
+template<> struct ColumnTypeResolver<Object>         { enum { Value = TypeObject }; };
+template<> struct ColumnTypeResolver<Statement>      { enum { Value = TypeStatement }; };
+
+/**
+* @brief Check and fill the elements of a typed row tuple from the resultset columns
+*/
+template<class T, std::size_t N = std::tuple_size<T>::value>
+struct RowTupleBinder
+{
+    typedef typename std::tuple_element<N - 1, T>::type ElementType;
+
+    static void CheckTypes(OCI_Resultset *rs, const unsigned int *indexes)
+    {
+        RowTupleBinder<T, N - 1>::CheckTypes(rs, indexes);
+
+        Check(OCI_CheckColumnType(rs, indexes[N - 1], static_cast<unsigned int>(ColumnTypeResolver<ElementType>::Value)));
+    }
+
+    static void Fill(const Resultset &rs, const unsigned int *indexes, T &row)
+    {
+        RowTupleBinder<T, N - 1>::Fill(rs, indexes, row);
+
+        rs.Get(indexes[N - 1], std::get<N - 1>(row));
+    }
+};
+
+template<class T>
+struct RowTupleBinder<T, 0>
+{
+    static void CheckTypes(OCI_Resultset *, const unsigned int *)
+    {
+
+    }
+
+    static void Fill(const Resultset &, const unsigned int *, T &)
+    {
+
+    }
+};
+
+/**
+* @brief Native array storage of numeric values bound by BatchWriter
+*/
+template<class T, boolean (OCI_API *M)(OCI_Statement *, const otext *, T *, unsigned int)>
+class BatchNumericColumn
+{
+public:
+
+    void Allocate(OCI_Connection *, unsigned int capacity)
+    {
+        _values.resize(capacity);
+    }
+
+    unsigned int Set(unsigned int index, const T &value)
+    {
+        _values[index] = value;
+
+        return sizeof(T);
+    }
+
+    T Get(unsigned int index) const
+    {
+        return _values[index];
+    }
+
+    bool IsBindRequired() const
+    {
+        return false;
+    }
+
+    void Bind(OCI_Statement *stmt, const ostring &name)
+    {
+        Check(M(stmt, name.c_str(), &_values[0], 0));
+    }
+
+private:
+
+    std::vector<T> _values;
+};
+
+template<> class BatchColumn<short>          : public BatchNumericColumn<short,          OCI_BindArrayOfShorts>{};
+template<> class BatchColumn<unsigned short> : public BatchNumericColumn<unsigned short, OCI_BindArrayOfUnsignedShorts>{};
+template<> class BatchColumn<int>            : public BatchNumericColumn<int,            OCI_BindArrayOfInts>{};
+template<> class BatchColumn<unsigned int>   : public BatchNumericColumn<unsigned int,   OCI_BindArrayOfUnsignedInts>{};
+template<> class BatchColumn<big_int>        : public BatchNumericColumn<big_int,        OCI_BindArrayOfBigInts>{};
+template<> class BatchColumn<big_uint>       : public BatchNumericColumn<big_uint,       OCI_BindArrayOfUnsignedBigInts>{};
+template<> class BatchColumn<float>          : public BatchNumericColumn<float,          OCI_BindArrayOfFloats>{};
+template<> class BatchColumn<double>         : public BatchNumericColumn<double,         OCI_BindArrayOfDoubles>{};
+
+/**
+* @brief Native array storage of string values bound by BatchWriter
+*
+* Values are stored in fixed size slots that are enlarged when a longer value is stored
+*/
+template<>
+class BatchColumn<ostring>
+{
+public:
+
+    BatchColumn() : _capacity(0), _size(0), _resized(false)
+    {
+
+    }
+
+    void Allocate(OCI_Connection *, unsigned int capacity)
+    {
+        const unsigned int DefaultSize = 32;
+
+        _capacity = capacity;
+        _size     = DefaultSize;
+        _values.assign(static_cast<size_t>(_capacity) * (_size + 1), 0);
+    }
+
+    unsigned int Set(unsigned int index, const ostring &value)
+    {
+        const unsigned int length = static_cast<unsigned int>(value.size());
+
+        if (length > _size)
+        {
+            Resize(index, std::max(length, _size * 2));
+        }
+
+        otext *slot = &_values[static_cast<size_t>(index) * (_size + 1)];
+
+        std::copy(value.begin(), value.end(), slot);
+
+        slot[length] = 0;
+
+        return length * sizeof(otext);
+    }
+
+    ostring Get(unsigned int index) const
+    {
+        return ostring(&_values[static_cast<size_t>(index) * (_size + 1)]);
+    }
+
+    bool IsBindRequired() const
+    {
+        return _resized;
+    }
+
+    void Bind(OCI_Statement *stmt, const ostring &name)
+    {
+        Check(OCI_BindArrayOfStrings(stmt, name.c_str(), &_values[0], _size, 0));
+
+        _resized = false;
+    }
+
+private:
+
+    void Resize(unsigned int count, unsigned int size)
+    {
+        std::vector<otext> values(static_cast<size_t>(_capacity) * (size + 1), 0);
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            const otext *slot = &_values[static_cast<size_t>(i) * (_size + 1)];
+
+            std::copy(slot, slot + _size + 1, &values[static_cast<size_t>(i) * (size + 1)]);
+        }
+
+        _values.swap(values);
+
+        _size    = size;
+        _resized = true;
+    }
+
+    std::vector<otext> _values;
+    unsigned int _capacity;
+    unsigned int _size;
+    bool _resized;
+};
+
+/**
+* @brief Native array storage of date values bound by BatchWriter
+*/
+template<>
+class BatchColumn<Date>
+{
+public:
+
+    BatchColumn() : _values(nullptr)
+    {
+
+    }
+
+    ~BatchColumn() noexcept
+    {
+        if (_values)
+        {
+            OCI_DateArrayFree(_values);
+        }
+    }
+
+    void Allocate(OCI_Connection *con, unsigned int capacity)
+    {
+        _values = Check(OCI_DateArrayCreate(con, capacity));
+    }
+
+    unsigned int Set(unsigned int index, const Date &value)
+    {
+        const unsigned int DateSize = 7;
+
+        Check(OCI_DateAssign(_values[index], value));
+
+        return DateSize;
+    }
+
+    Date Get(unsigned int index) const
+    {
+        Date date(true);
+
+        Check(OCI_DateAssign(date, _values[index]));
+
+        return date;
+    }
+
+    bool IsBindRequired() const
+    {
+        return false;
+    }
+
+    void Bind(OCI_Statement *stmt, const ostring &name)
+    {
+        Check(OCI_BindArrayOfDates(stmt, name.c_str(), _values, 0));
+    }
+
+private:
+
+    OCI_Date **_values;
+};
+
+/**
+* @brief Allocate, bind and read back the column buffers of a BatchWriter
+*/
+template<class C, std::size_t N = std::tuple_size<C>::value>
+struct BatchColumnsHandler
+{
+    static void Allocate(C &columns, OCI_Connection *con, unsigned int capacity)
+    {
+        BatchColumnsHandler<C, N - 1>::Allocate(columns, con, capacity);
+
+        std::get<N - 1>(columns).Allocate(con, capacity);
+    }
+
+    static void Bind(C &columns, OCI_Statement *stmt, const std::vector<ostring> &names, bool force)
+    {
+        BatchColumnsHandler<C, N - 1>::Bind(columns, stmt, names, force);
+
+        if (force || std::get<N - 1>(columns).IsBindRequired())
+        {
+            std::get<N - 1>(columns).Bind(stmt, names[N - 1]);
+        }
+    }
+
+    template<class R>
+    static void Fill(const C &columns, unsigned int index, R &row)
+    {
+        BatchColumnsHandler<C, N - 1>::Fill(columns, index, row);
+
+        std::get<N - 1>(row) = std::get<N - 1>(columns).Get(index);
+    }
+};
+
+template<class C>
+struct BatchColumnsHandler<C, 0>
+{
+    static void Allocate(C &, OCI_Connection *, unsigned int)
+    {
+
+    }
+
+    static void Bind(C &, OCI_Statement *, const std::vector<ostring> &, bool)
+    {
+
+    }
+
+    template<class R>
+    static void Fill(const C &, unsigned int, R &)
+    {
+
+    }
+};
+
+inline const boolean * GetLastErrorFlag()
+{
+#ifdef HAS_THREAD_LOCAL
+
+    static thread_local const boolean *flag = OCI_GetLastErrorFlag();
+
+    return flag;
+
+#else
+
+    return OCI_GetLastErrorFlag();
+
+#endif
+}
+
 template<class T>
 T Check(T result)
 {
-    OCI_Error *err = OCI_GetLastError();
+    const boolean *flag = GetLastErrorFlag();
 
-    if (err)
+    /* the error handle only needs to be retrieved when the C layer flagged an error */
+
+    if (!flag || *flag)
     {
-        throw Exception(err);
+        OCI_Error *err = OCI_GetLastError();
+
+        if (err)
+        {
+            throw Exception(err);
+        }
     }
 
     return result;
@@ -465,6 +798,17 @@ ManagedBuffer<T>::operator T* ()
     return  _buffer;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * MemoryStreamBuffer
+ * --------------------------------------------------------------------------------------------- */
+
+inline MemoryStreamBuffer::MemoryStreamBuffer(const void *data, size_t size)
+{
+    char *begin = const_cast<char *>(static_cast<const char *>(data));
+
+    setg(begin, begin, begin + size);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * Handle
  * --------------------------------------------------------------------------------------------- */
@@ -974,7 +1318,14 @@ inline Exception::Exception(OCI_Error *err) noexcept
     SetWhat(OCI_ErrorGetString(err));
 }
 
-inline Exception::Exception(const Exception& other) noexcept : Exception(nullptr)
+inline Exception::Exception(const Exception& other) noexcept
+    : _what(nullptr),
+    _pStatement(other._pStatement),
+    _pConnnection(other._pConnnection),
+    _row(other._row),
+    _type(other._type),
+    _errLib(other._errLib),
+    _errOracle(other._errOracle)
 {
     SetWhat(other._what);
 }
@@ -988,7 +1339,17 @@ inline Exception& Exception::operator = (const Exception& other) noexcept
 {
     if (this != &other)
     {
-        _what = ostrdup(other._what);
+        delete [] _what;
+
+        _what         = nullptr;
+        _pStatement   = other._pStatement;
+        _pConnnection = other._pConnnection;
+        _row          = other._row;
+        _type         = other._type;
+        _errLib       = other._errLib;
+        _errOracle    = other._errOracle;
+
+        SetWhat(other._what);
     }
 
     return *this;
@@ -1235,6 +1596,26 @@ inline void Environment::NotifyHandlerAQ(OCI_Dequeue *pDequeue)
     }
 }
 
+inline void Environment::LongHandler(OCI_Resultset *pResultset, unsigned int index, unsigned int row, const void *buffer, unsigned int size, boolean last)
+{
+    OCI_Statement *pStatement = Check(OCI_ResultsetGetStatement(pResultset));
+
+    const Statement::LongHandlerProc handler = GetUserCallback<Statement::LongHandlerProc>(pStatement);
+
+    if (handler)
+    {
+        const unsigned int subType = Check(OCI_ColumnGetSubType(Check(OCI_GetColumn(pResultset, index))));
+
+        const size_t bytes = size * (OCI_CLONG == subType ? sizeof(otext) : sizeof(unsigned char));
+
+        Resultset resultset(pResultset, nullptr);
+        MemoryStreamBuffer streamBuffer(buffer, bytes);
+        std::istream piece(&streamBuffer);
+
+        handler(resultset, index, row, piece, last == TRUE);
+    }
+}
+
 template<class T>
 T Environment::GetUserCallback(AnyPointer ptr)
 {
@@ -1714,6 +2095,21 @@ inline void Connection::SetStatementCacheSize(unsigned int value)
     Check(OCI_SetStatementCacheSize(*this, value));
 }
 
+inline Statement Connection::GetCachedStatement(const ostring& sql) const
+{
+    return Statement(Check(OCI_GetCachedStatement(*this, sql.c_str())), GetHandle());
+}
+
+inline unsigned int Connection::GetCachedStatementLimit() const
+{
+    return Check(OCI_GetCachedStatementLimit(*this));
+}
+
+inline void Connection::SetCachedStatementLimit(unsigned int value)
+{
+    Check(OCI_SetCachedStatementLimit(*this, value));
+}
+
 inline unsigned int Connection::GetDefaultLobPrefetchSize() const
 {
     return Check(OCI_GetDefaultLobPrefetchSize(*this));
@@ -4635,7 +5031,7 @@ inline Raw Long<Raw, LongBinary>::GetContent() const
  * BindObject
  * --------------------------------------------------------------------------------------------- */
 
-inline BindObject::BindObject(const Statement &statement, const ostring& name, unsigned int mode) : _statement(statement), _name(name), _mode(mode)
+inline BindObject::BindObject(const Statement &statement, const ostring& name, unsigned int mode) : _statement(statement), _name(name), _mode(mode), _bind(nullptr)
 {
 }
 
@@ -4658,6 +5054,16 @@ inline unsigned int BindObject::GetMode() const
     return _mode;
 }
 
+inline OCI_Bind * BindObject::GetBind() const
+{
+    return _bind;
+}
+
+inline void BindObject::SetBind(OCI_Bind *bind)
+{
+    _bind = bind;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * BindArray
  * --------------------------------------------------------------------------------------------- */
@@ -4684,20 +5090,23 @@ typename BindResolver<T>::OutputType * BindArray::GetData()  const
     return static_cast<typename BindResolver<T>::OutputType *>(*(dynamic_cast< BindArrayObject<T> * > (_object)));
 }
 
-inline void BindArray::SetInData()
+inline bool BindArray::SetInData()
 {
+    _object->CheckData();
 
     if (GetMode() & OCI_BDM_IN || _object->IsHandleObject())
     {
-        _object->SetInData();
+        return _object->SetInData(_bind);
     }
+
+    return false;
 }
 
 inline void BindArray::SetOutData()
 {
     if (GetMode() & OCI_BDM_OUT)
     {
-        _object->SetOutData();
+        _object->SetOutData(_bind);
     }
 }
 
@@ -4711,9 +5120,23 @@ inline unsigned int BindArray::GetSizeForBindCall() const
     return _object ? _object->GetSizeForBindCall() : 0;
 }
 
+inline void BindArray::ThrowVectorResized(const Statement &statement, const ostring &name)
+{
+    Exception exception;
+
+    exception._pStatement   = statement;
+    exception._pConnnection = OCI_StatementGetConnection(statement);
+    exception._type         = Exception::OcilibError;
+    exception._errLib       = OCI_ERR_BIND_ARRAY_SIZE;
+
+    exception.SetWhat((OTEXT("Binding '") + name + OTEXT("': vector has been resized since binding")).c_str());
+
+    throw exception;
+}
+
 template<class T>
 BindArray::BindArrayObject<T>::BindArrayObject(const Statement &statement, const ostring &name, ObjectVector &vector, bool isPlSqlTable, unsigned int mode, unsigned int elemSize)
-    : _statement(statement), _name(name), _vector(vector), _data(nullptr), _isPlSqlTable(isPlSqlTable), _mode(mode), _elemCount(BindArrayObject<T>::GetSize()), _elemSize(elemSize)
+    : _statement(statement), _name(name), _vector(vector), _data(nullptr), _isPlSqlTable(isPlSqlTable), _mode(mode), _elemCount(BindArrayObject<T>::GetSize()), _elemSize(elemSize), _direct(false)
 {
     AllocData();
 }
@@ -4727,9 +5150,21 @@ BindArray::BindArrayObject<T>::~BindArrayObject() noexcept
 template<class T>
 void BindArray::BindArrayObject<T>::AllocData()
 {
-    _data = new NativeType[_elemCount];
+    /* vectors of native numeric values holding all elements are bound in place */
+
+    if (_vector.size() >= _elemCount)
+    {
+        _data = GetVectorData(_vector);
+    }
 
-    memset(_data, 0, sizeof(NativeType) * _elemCount);
+    _direct = (nullptr != _data);
+
+    if (!_direct)
+    {
+        _data = new NativeType[_elemCount];
+
+        memset(_data, 0, sizeof(NativeType) * _elemCount);
+    }
 }
 
 template<>
@@ -4751,63 +5186,139 @@ inline void BindArray::BindArrayObject<Raw> ::AllocData()
 template<class T>
 void BindArray::BindArrayObject<T>::FreeData() const
 {
-    delete [] _data ;
+    if (!_direct)
+    {
+        delete [] _data;
+    }
 }
 
 template<class T>
-void BindArray::BindArrayObject<T>::SetInData()
+void BindArray::BindArrayObject<T>::CheckData() const
 {
-    typename ObjectVector::iterator it, it_end;
+    /* the storage of a vector bound in place must not change until execution */
 
-    unsigned int index = 0;
-    const unsigned int currElemCount = GetSize();
+    const unsigned int count = _isPlSqlTable ? _elemCount : GetSize();
 
-    for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+    if (_direct && (_vector.size() < count || GetVectorData(_vector) != _data))
     {
-        _data[index] = static_cast<NativeType>(*it);
+        ThrowVectorResized(_statement, _name);
     }
 }
 
-template<>
-inline void BindArray::BindArrayObject<ostring>::SetInData()
+template<class T>
+typename BindArray::BindArrayObject<T>::NativeType * BindArray::BindArrayObject<T>::GetVectorData(std::vector<NativeType> &vector)
 {
-    std::vector<ostring>::iterator it, it_end;
+    return vector.empty() ? nullptr : &vector[0];
+}
 
-    unsigned int index = 0;
-    const unsigned int currElemCount = GetSize();
+template<class T>
+template<class U>
+typename BindArray::BindArrayObject<T>::NativeType * BindArray::BindArrayObject<T>::GetVectorData(std::vector<U> &)
+{
+    return nullptr;
+}
 
-    for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+template<class T>
+bool BindArray::BindArrayObject<T>::SetInData(OCI_Bind *)
+{
+    if (_direct)
     {
-        const ostring & value = *it;
+        /* vectors bound in place are read by OCI, except big integers that are encoded
+           into an internal buffer of the bind before each execution */
 
-        memcpy( _data + (_elemSize * index), value.c_str(), (value.size() + 1) * sizeof(otext));
+        return IsSame<T, big_int>::value || IsSame<T, big_uint>::value;
     }
-}
 
-template<>
-inline void BindArray::BindArrayObject<Raw>::SetInData()
-{
-    std::vector<Raw>::iterator it, it_end;
+    typename ObjectVector::iterator it, it_end;
 
     unsigned int index = 0;
     const unsigned int currElemCount = GetSize();
+    bool refreshed = false;
 
     for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
     {
-        Raw & value = *it;
+        const NativeType value = static_cast<NativeType>(*it);
+
+        /* handles are always refreshed as their content may have changed */
 
-        if (!value.empty())
+        if (BindResolver<T>::IsHandle || _data[index] != value)
         {
-            memcpy(_data + (_elemSize * index), &value[0], value.size());
+            _data[index] = value;
+            refreshed = true;
         }
-
-        OCI_BindSetDataSizeAtPos(OCI_GetBind2(_statement, GetName().c_str()), index + 1, static_cast<unsigned int>(value.size()));
     }
+
+    return refreshed;
+}
+
+template<>
+inline bool BindArray::BindArrayObject<ostring>::SetInData(OCI_Bind *)
+{
+    std::vector<ostring>::iterator it, it_end;
+
+    unsigned int index = 0;
+    const unsigned int currElemCount = GetSize();
+    bool refreshed = false;
+
+    for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+    {
+        const ostring & value = *it;
+
+        otext *currData = _data + (_elemSize * index);
+
+        const size_t size = (value.size() + 1) * sizeof(otext);
+
+        if (memcmp(currData, value.c_str(), size) != 0)
+        {
+            memcpy(currData, value.c_str(), size);
+            refreshed = true;
+        }
+    }
+
+    return refreshed;
+}
+
+template<>
+inline bool BindArray::BindArrayObject<Raw>::SetInData(OCI_Bind *bind)
+{
+    std::vector<Raw>::iterator it, it_end;
+
+    unsigned int index = 0;
+    const unsigned int currElemCount = GetSize();
+    bool refreshed = false;
+
+    for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+    {
+        Raw & value = *it;
+
+        unsigned char *currData = _data + (_elemSize * index);
+
+        const unsigned int size = static_cast<unsigned int>(value.size());
+
+        if (!value.empty() && memcmp(currData, &value[0], value.size()) != 0)
+        {
+            memcpy(currData, &value[0], value.size());
+            refreshed = true;
+        }
+
+        if (Check(OCI_BindGetDataSizeAtPos(bind, index + 1)) != size)
+        {
+            OCI_BindSetDataSizeAtPos(bind, index + 1, size);
+            refreshed = true;
+        }
+    }
+
+    return refreshed;
 }
 
 template<class T>
-void BindArray::BindArrayObject<T>::SetOutData()
+void BindArray::BindArrayObject<T>::SetOutData(OCI_Bind *)
 {
+    if (_direct)
+    {
+        return;
+    }
+
     typename ObjectVector::iterator it, it_end;
 
     unsigned int index = 0;
@@ -4820,12 +5331,10 @@ void BindArray::BindArrayObject<T>::SetOutData()
 }
 
 template<>
-inline void BindArray::BindArrayObject<ostring>::SetOutData()
+inline void BindArray::BindArrayObject<ostring>::SetOutData(OCI_Bind *pBind)
 {
     std::vector<ostring>::iterator it, it_end;
 
-    OCI_Bind *pBind = Check(OCI_GetBind2(_statement, GetName().c_str()));
-
     unsigned int index = 0;
     const unsigned int currElemCount = GetSize();
 
@@ -4838,12 +5347,10 @@ inline void BindArray::BindArrayObject<ostring>::SetOutData()
 }
 
 template<>
-inline void BindArray::BindArrayObject<Raw>::SetOutData()
+inline void BindArray::BindArrayObject<Raw>::SetOutData(OCI_Bind *pBind)
 {
     std::vector<Raw>::iterator it, it_end;
 
-    OCI_Bind *pBind = Check(OCI_GetBind2(_statement, GetName().c_str()));
-
     unsigned int index = 0;
     const unsigned int currElemCount = GetSize();
 
@@ -4896,7 +5403,7 @@ BindArray::BindArrayObject<T>::operator NativeType * ()  const
  * --------------------------------------------------------------------------------------------- */
 
 template<class T>
-void BindObjectAdaptor<T>::SetInData()
+bool BindObjectAdaptor<T>::SetInData()
 {
     if (GetMode() & OCI_BDM_IN)
     {
@@ -4907,13 +5414,20 @@ void BindObjectAdaptor<T>::SetInData()
             size = _size;
         }
 
-        if (size > 0)
+        if (_data[size] != 0 || (size > 0 && memcmp(_data, &_object[0], size * sizeof(NativeType)) != 0))
         {
-            memcpy(_data, &_object[0], size * sizeof(NativeType));
-        }
+            if (size > 0)
+            {
+                memcpy(_data, &_object[0], size * sizeof(NativeType));
+            }
+
+            _data[size] = 0;
 
-        _data[size] = 0;
+            return true;
+        }
     }
+
+    return false;
 }
 
 template<class T>
@@ -4921,7 +5435,7 @@ void BindObjectAdaptor<T>::SetOutData()
 {
     if (GetMode() & OCI_BDM_OUT)
     {
-        size_t size = Check(OCI_BindGetDataSize(Check(OCI_GetBind2(_statement, _name.c_str()))));
+        size_t size = Check(OCI_BindGetDataSize(_bind));
 
         _object.assign(_data, _data + size);
     }
@@ -4934,7 +5448,7 @@ BindObjectAdaptor<T>::BindObjectAdaptor(const Statement &statement, const ostrin
      _data(new NativeType[size + 1]),
      _size(size)
 {
-    memset(_data, 0, _size * sizeof(NativeType));
+    memset(_data, 0, (_size + 1) * sizeof(NativeType));
 }
 
 template<class T>
@@ -4954,12 +5468,21 @@ BindObjectAdaptor<T>::operator NativeType *()  const
  * --------------------------------------------------------------------------------------------- */
 
 template<class T>
-void BindTypeAdaptor<T>::SetInData()
+bool BindTypeAdaptor<T>::SetInData()
 {
     if (GetMode() & OCI_BDM_IN)
     {
-        *_data = static_cast<NativeType>(_object);
+        const NativeType value = static_cast<NativeType>(_object);
+
+        if (BindResolver<T>::IsHandle || *_data != value)
+        {
+            *_data = value;
+
+            return true;
+        }
     }
+
+    return false;
 }
 
 template<class T>
@@ -4975,7 +5498,7 @@ template<class T>
 BindTypeAdaptor<T>::BindTypeAdaptor(const Statement &statement, const ostring& name, unsigned int mode, ObjectType &object) :
 BindObject(statement, name, mode),
 _object(object),
-_data(new NativeType)
+_data(new NativeType())
 {
 
 }
@@ -4993,12 +5516,21 @@ BindTypeAdaptor<T>::operator NativeType *()  const
 }
 
 template<>
-inline void BindTypeAdaptor<bool>::SetInData()
+inline bool BindTypeAdaptor<bool>::SetInData()
 {
     if (GetMode() & OCI_BDM_IN)
     {
-        *_data = (_object == true);
+        const boolean value = (_object == true);
+
+        if (*_data != value)
+        {
+            *_data = value;
+
+            return true;
+        }
     }
+
+    return false;
 }
 
 template<>
@@ -5038,6 +5570,8 @@ inline void BindsHolder::Clear()
 
 inline void BindsHolder::AddBindObject(BindObject *bindObject)
 {
+    bindObject->SetBind(Check(OCI_GetBind2(_statement, bindObject->GetName().c_str())));
+
     if (Check(OCI_IsRebindingAllowed(_statement)))
     {
         std::vector<BindObject *>::iterator it, it_end;
@@ -5069,9 +5603,16 @@ inline void BindsHolder::SetInData()
 {
     std::vector<BindObject *>::iterator it, it_end;
 
+    const bool tracking = (Check(OCI_IsBindTrackingEnabled(_statement)) == TRUE);
+
     for(it = _bindObjects.begin(), it_end = _bindObjects.end(); it != it_end; ++it)
     {
-        (*it)->SetInData();
+        /* only binds whose intermediate buffer has been modified need to be processed again */
+
+        if ((*it)->SetInData() && tracking)
+        {
+            Check(OCI_BindSetDirty((*it)->GetBind()));
+        }
     }
 }
 
@@ -5136,6 +5677,16 @@ inline BindInfo::BindDirection BindInfo::GetDirection() const
     return BindDirection(static_cast<BindDirection::Type>(Check(OCI_BindGetDirection(*this))));
 }
 
+inline void BindInfo::SetDirty()
+{
+    Check(OCI_BindSetDirty(*this));
+}
+
+inline bool BindInfo::IsDirty() const
+{
+    return (Check(OCI_BindIsDirty(*this)) == TRUE);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * Statement
  * --------------------------------------------------------------------------------------------- */
@@ -5294,6 +5845,26 @@ inline unsigned int Statement::GetBindArraySize() const
     return Check(OCI_BindArrayGetSize(*this));
 }
 
+inline void Statement::SetBindArrayChunkSize(unsigned int size)
+{
+    Check(OCI_BindArraySetChunkSize(*this, size));
+}
+
+inline unsigned int Statement::GetBindArrayChunkSize() const
+{
+    return Check(OCI_BindArrayGetChunkSize(*this));
+}
+
+inline void Statement::SetBindArrayChunkMemory(unsigned int size)
+{
+    Check(OCI_BindArraySetChunkMemory(*this, size));
+}
+
+inline unsigned int Statement::GetBindArrayChunkMemory() const
+{
+    return Check(OCI_BindArrayGetChunkMemory(*this));
+}
+
 inline void Statement::AllowRebinding(bool value)
 {
     Check(OCI_AllowRebinding(*this, value));
@@ -5304,6 +5875,16 @@ inline bool Statement::IsRebindingAllowed() const
     return (Check(OCI_IsRebindingAllowed(*this)) == TRUE);
 }
 
+inline void Statement::EnableBindTracking(bool value)
+{
+    Check(OCI_EnableBindTracking(*this, value));
+}
+
+inline bool Statement::IsBindTrackingEnabled() const
+{
+    return (Check(OCI_IsBindTrackingEnabled(*this)) == TRUE);
+}
+
 inline unsigned int Statement::GetBindIndex(const ostring& name) const
 {
     return Check(OCI_GetBindIndex(*this, name.c_str()));
@@ -5984,6 +6565,46 @@ inline unsigned int Statement::GetFetchSize() const
    return Check(OCI_GetFetchSize(*this));
 }
 
+inline void Statement::SetFetchMemory(unsigned int value)
+{
+    Check(OCI_SetFetchMemory(*this, value));
+}
+
+inline unsigned int Statement::GetFetchMemory() const
+{
+    return Check(OCI_GetFetchMemory(*this));
+}
+
+inline void Statement::SetPipelinedFetch(bool value)
+{
+    Check(OCI_SetPipelinedFetch(*this, value));
+}
+
+inline bool Statement::GetPipelinedFetch() const
+{
+    return (Check(OCI_GetPipelinedFetch(*this)) == TRUE);
+}
+
+inline void Statement::SetFetchCacheSize(unsigned int value)
+{
+    Check(OCI_SetFetchCacheSize(*this, value));
+}
+
+inline unsigned int Statement::GetFetchCacheSize() const
+{
+    return Check(OCI_GetFetchCacheSize(*this));
+}
+
+inline void Statement::SetFetchCacheMemory(unsigned int value)
+{
+    Check(OCI_SetFetchCacheMemory(*this, value));
+}
+
+inline unsigned int Statement::GetFetchCacheMemory() const
+{
+    return Check(OCI_GetFetchCacheMemory(*this));
+}
+
 inline void Statement::SetPrefetchSize(unsigned int value)
 {
     Check(OCI_SetPrefetchSize(*this, value));
@@ -6024,6 +6645,13 @@ inline Statement::LongMode Statement::GetLongMode() const
     return LongMode(static_cast<LongMode::Type>(Check(OCI_GetLongMode(*this))));
 }
 
+inline void Statement::SetLongHandler(LongHandlerProc handler)
+{
+    Check(OCI_SetLongHandler(*this, static_cast<POCI_LONG_HANDLER>(handler != nullptr ? Environment::LongHandler : nullptr)));
+
+    Environment::SetUserCallback<Statement::LongHandlerProc>(static_cast<OCI_Statement*>(*this), handler);
+}
+
 inline unsigned int Statement::GetSQLCommand() const
 {
     return Check(OCI_GetSQLCommand(*this));
@@ -6114,6 +6742,8 @@ inline void Statement::OnFreeSmartHandle(SmartHandle *smartHandle)
         smartHandle->SetExtraInfos(nullptr);
 
         delete bindsHolder;
+
+        Environment::SetUserCallback<LongHandlerProc>(smartHandle->GetHandle(), nullptr);
     }
 }
 
@@ -6135,6 +6765,422 @@ inline BindsHolder * Statement::GetBindsHolder(bool create) const
     return bindsHolder;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * BatchWriter
+ * --------------------------------------------------------------------------------------------- */
+
+template<class... T>
+BatchWriter<T...>::Error::Error(const Exception &exception, const Row &row, big_uint index) :
+    _exception(exception), _row(row), _index(index)
+{
+
+}
+
+template<class... T>
+const Exception& BatchWriter<T...>::Error::GetException() const
+{
+    return _exception;
+}
+
+template<class... T>
+const typename BatchWriter<T...>::Row& BatchWriter<T...>::Error::GetRow() const
+{
+    return _row;
+}
+
+template<class... T>
+big_uint BatchWriter<T...>::Error::GetIndex() const
+{
+    return _index;
+}
+
+template<class... T>
+BatchWriter<T...>::BatchWriter(const Statement &statement, const std::vector<ostring> &names, unsigned int maxRows,
+                               unsigned int maxBytes, bool background) :
+    _statement(statement),
+    _names(names),
+    _maxRows(std::max(maxRows, 1u)),
+    _maxBytes(maxBytes),
+    _background(background),
+    _buffer(0),
+    _count(0),
+    _bytes(0),
+    _bound(-1),
+    _thread(nullptr),
+    _running(false),
+    _flushBuffer(0),
+    _flushCount(0),
+    _flushOffset(0),
+    _flushAffectedRows(0),
+    _flushErrors(),
+    _failure(),
+    _rowCount(0),
+    _affectedRows(0)
+{
+    OCI_Statement *stmt = _statement;
+    OCI_Connection *con = Check(OCI_StatementGetConnection(stmt));
+
+    if (_names.size() != sizeof...(T))
+    {
+        Exception exception;
+
+        exception._pStatement   = stmt;
+        exception._pConnnection = con;
+        exception._type         = Exception::OcilibError;
+        exception._errLib       = OCI_ERR_ARG_INVALID_VALUE;
+
+        exception.SetWhat(OTEXT("BatchWriter: the number of bind names does not match the number of row values"));
+
+        throw exception;
+    }
+
+    /* the array size must be set before binding and buffers are rebound when switched or enlarged */
+
+    Check(OCI_AllowRebinding(stmt, TRUE));
+    Check(OCI_BindArraySetSize(stmt, _maxRows));
+
+    BatchColumnsHandler<Columns>::Allocate(_columns[0], con, _maxRows);
+
+    if (_background)
+    {
+        BatchColumnsHandler<Columns>::Allocate(_columns[1], con, _maxRows);
+    }
+
+    /* binding the first buffers here reports invalid bind names at construction */
+
+    try
+    {
+        BatchColumnsHandler<Columns>::Bind(_columns[0], stmt, _names, true);
+
+        _bound = 0;
+
+        if (_background)
+        {
+            _thread = Thread::Create();
+        }
+    }
+    catch (...)
+    {
+        ReleaseBinds();
+        throw;
+    }
+}
+
+template<class... T>
+BatchWriter<T...>::~BatchWriter() noexcept
+{
+    try
+    {
+        Flush();
+    }
+    catch (...)
+    {
+
+    }
+
+    if (_running)
+    {
+        OCI_ThreadJoin(_thread);
+    }
+
+    if (_thread)
+    {
+        OCI_ThreadFree(_thread);
+    }
+
+    ReleaseBinds();
+}
+
+template<class... T>
+void BatchWriter<T...>::Add(const T&... values)
+{
+    /* buffers are still full when the previous background flush failed */
+
+    if (_count >= _maxRows)
+    {
+        Dispatch();
+    }
+
+    _bytes += SetValues<0>(_columns[_buffer], _count, values...);
+
+    _count++;
+    _rowCount++;
+
+    if (_count >= _maxRows || (_maxBytes > 0 && _bytes >= _maxBytes))
+    {
+        Dispatch();
+    }
+}
+
+template<class... T>
+void BatchWriter<T...>::Flush()
+{
+    Dispatch();
+    Wait();
+}
+
+template<class... T>
+big_uint BatchWriter<T...>::GetRowCount() const
+{
+    return _rowCount;
+}
+
+template<class... T>
+big_uint BatchWriter<T...>::GetAffectedRows() const
+{
+    return _affectedRows;
+}
+
+template<class... T>
+const std::vector<typename BatchWriter<T...>::Error>& BatchWriter<T...>::GetErrors() const
+{
+    return _errors;
+}
+
+template<class... T>
+void BatchWriter<T...>::ClearErrors()
+{
+    _errors.clear();
+}
+
+template<class... T>
+void BatchWriter<T...>::FlushProc(ThreadHandle, AnyPointer arg)
+{
+    BatchWriter *writer = static_cast<BatchWriter *>(arg);
+
+    /* exceptions cannot cross the thread boundary and are thrown back by Wait() */
+
+    try
+    {
+        writer->Execute(writer->_flushBuffer, writer->_flushCount, writer->_flushOffset,
+                        writer->_flushAffectedRows, writer->_flushErrors);
+    }
+    catch (...)
+    {
+        writer->_failure = std::current_exception();
+    }
+}
+
+template<class... T>
+void BatchWriter<T...>::Dispatch()
+{
+    if (_count == 0)
+    {
+        return;
+    }
+
+    const unsigned int buffer = _buffer;
+    const unsigned int count  = _count;
+    const big_uint offset     = _rowCount - _count;
+
+    if (_background)
+    {
+        /* the other buffers are filled while the worker thread sends the current ones */
+
+        Wait();
+
+        _flushBuffer = buffer;
+        _flushCount  = count;
+        _flushOffset = offset;
+
+        Thread::Run(_thread, FlushProc, this);
+
+        _running = true;
+        _buffer  = 1 - _buffer;
+    }
+
+    /* rows of a failed flush are not kept for later attempts */
+
+    _count = 0;
+    _bytes = 0;
+
+    if (!_background)
+    {
+        Execute(buffer, count, offset, _affectedRows, _errors);
+    }
+}
+
+template<class... T>
+void BatchWriter<T...>::Wait()
+{
+    if (_running)
+    {
+        _running = false;
+
+        Thread::Join(_thread);
+
+        /* results of the background flush are only merged once the worker thread is done */
+
+        _affectedRows += _flushAffectedRows;
+        _errors.insert(_errors.end(), _flushErrors.begin(), _flushErrors.end());
+
+        _flushAffectedRows = 0;
+        _flushErrors.clear();
+    }
+
+    if (_failure)
+    {
+        std::exception_ptr failure = _failure;
+
+        _failure = nullptr;
+
+        std::rethrow_exception(failure);
+    }
+}
+
+template<class... T>
+void BatchWriter<T...>::ReleaseBinds() noexcept
+{
+    /* OCI binds keep pointing to the column buffers until the statement is prepared again */
+
+    try
+    {
+        _statement.Prepare(_statement.GetSql());
+    }
+    catch (...)
+    {
+
+    }
+
+    _bound = -1;
+}
+
+template<class... T>
+void BatchWriter<T...>::Execute(unsigned int buffer, unsigned int count, big_uint offset,
+                                big_uint &affectedRows, std::vector<Error> &errors)
+{
+    OCI_Statement *stmt = _statement;
+    Columns &columns    = _columns[buffer];
+
+    BatchColumnsHandler<Columns>::Bind(columns, stmt, _names, _bound != static_cast<int>(buffer));
+
+    _bound = static_cast<int>(buffer);
+
+    Check(OCI_BindArraySetSize(stmt, count));
+
+    /* rows in error are reported by the batch error list, any other failure is raised */
+
+    try
+    {
+        Check(OCI_Execute(stmt));
+    }
+    catch (Exception &exception)
+    {
+        /* single rows are not executed in batch error mode and their server errors are raised */
+
+        if (count == 1 && exception.GetType() == Exception::OracleError)
+        {
+            Row values;
+
+            BatchColumnsHandler<Columns>::Fill(columns, 0, values);
+
+            exception._row = 1;
+
+            errors.push_back(Error(exception, values, offset));
+
+            return;
+        }
+
+        if (Check(OCI_GetBatchErrorCount(stmt)) == 0)
+        {
+            throw;
+        }
+    }
+
+    affectedRows += Check(OCI_GetAffectedRows(stmt));
+
+    OCI_Error *err = Check(OCI_GetBatchError(stmt));
+
+    while (err)
+    {
+        const unsigned int row = OCI_ErrorGetRow(err);
+
+        if (row > 0 && row <= count)
+        {
+            Row values;
+
+            BatchColumnsHandler<Columns>::Fill(columns, row - 1, values);
+
+            errors.push_back(Error(Exception(err), values, offset + row - 1));
+        }
+
+        err = Check(OCI_GetBatchError(stmt));
+    }
+}
+
+template<class... T>
+template<std::size_t N>
+unsigned int BatchWriter<T...>::SetValues(Columns &, unsigned int)
+{
+    return 0;
+}
+
+template<class... T>
+template<std::size_t N, class V, class... R>
+unsigned int BatchWriter<T...>::SetValues(Columns &columns, unsigned int index, const V &value, const R&... others)
+{
+    return std::get<N>(columns).Set(index, value) + SetValues<N + 1>(columns, index, others...);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StringView
+ * --------------------------------------------------------------------------------------------- */
+
+inline StringView::StringView() : _data(nullptr), _size(0)
+{
+
+}
+
+inline StringView::StringView(const otext *data, size_type size) : _data(data), _size(size)
+{
+
+}
+
+inline const otext * StringView::data() const
+{
+    return _data;
+}
+
+inline StringView::size_type StringView::size() const
+{
+    return _size;
+}
+
+inline StringView::size_type StringView::length() const
+{
+    return _size;
+}
+
+inline bool StringView::empty() const
+{
+    return _size == 0;
+}
+
+inline StringView::const_iterator StringView::begin() const
+{
+    return _data;
+}
+
+inline StringView::const_iterator StringView::end() const
+{
+    return _data + _size;
+}
+
+inline otext StringView::operator [] (size_type index) const
+{
+    return _data[index];
+}
+
+inline ostring StringView::ToString() const
+{
+    return _data ? ostring(_data, _size) : ostring();
+}
+
+inline StringView::operator ostring() const
+{
+    return ToString();
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * Resultset
  * --------------------------------------------------------------------------------------------- */
@@ -6149,6 +7195,30 @@ inline bool Resultset::Next()
     return (Check(OCI_FetchNext(*this)) == TRUE);
 }
 
+inline ColumnBatch Resultset::NextBatch()
+{
+    unsigned int count = 0;
+
+    Check(OCI_FetchBatch(*this, &count));
+
+    return ColumnBatch(*this, count);
+}
+
+inline void Resultset::GetArrowSchema(struct ArrowSchema &schema) const
+{
+    Check(OCI_GetArrowSchema(*this, &schema));
+}
+
+inline unsigned int Resultset::NextArrowBatch(struct ArrowArray &array)
+{
+    return Check(OCI_FetchArrowBatch(*this, &array));
+}
+
+inline void Resultset::ExportArrowStream(int fd)
+{
+    Check(OCI_ExportArrowStream(*this, fd));
+}
+
 inline bool Resultset::Prev()
 {
     return (Check(OCI_FetchPrev(*this)) == TRUE);
@@ -6280,6 +7350,54 @@ unsigned int Resultset::ForEach(T callback, U adapter)
     return GetCurrentRow();
 }
 
+template<class T, class U>
+unsigned int Resultset::ForEachAs(U callback)
+{
+    std::vector<unsigned int> indexes(std::tuple_size<T>::value);
+
+    for (size_t i = 0; i < indexes.size(); i++)
+    {
+        indexes[i] = static_cast<unsigned int>(i + 1);
+    }
+
+    return FetchAs<T>(indexes, callback);
+}
+
+template<class T, class U>
+unsigned int Resultset::ForEachAs(const std::vector<ostring> &names, U callback)
+{
+    std::vector<unsigned int> indexes(std::tuple_size<T>::value);
+
+    /* elements without name are left to index 0 and rejected by the column type check */
+
+    for (size_t i = 0; i < indexes.size() && i < names.size(); i++)
+    {
+        indexes[i] = Check(OCI_GetColumnIndex(*this, names[i].c_str()));
+    }
+
+    return FetchAs<T>(indexes, callback);
+}
+
+template<class T, class U>
+unsigned int Resultset::FetchAs(const std::vector<unsigned int> &indexes, U callback)
+{
+    T row;
+
+    RowTupleBinder<T>::CheckTypes(*this, indexes.data());
+
+    while (Next())
+    {
+        RowTupleBinder<T>::Fill(*this, indexes.data(), row);
+
+        if (!callback(static_cast<const T&>(row)))
+        {
+            break;
+        }
+    }
+
+    return GetCurrentRow();
+}
+
 template<>
 inline short Resultset::Get<short>(unsigned int index) const
 {
@@ -6391,13 +7509,56 @@ inline Number Resultset::Get<Number>(const ostring& name) const
 template<>
 inline ostring Resultset::Get<ostring>(unsigned int index) const
 {
-    return MakeString(Check(OCI_GetString(*this, index)));
+    unsigned int size = 0;
+
+    const otext *data = Check(OCI_GetStringWithLength(*this, index, &size));
+
+    return MakeString(data, static_cast<int>(size));
 }
 
 template<>
 inline ostring Resultset::Get<ostring>(const ostring& name) const
 {
-    return MakeString(Check(OCI_GetString2(*this,name.c_str())));
+    return Get<ostring>(Check(OCI_GetColumnIndex(*this, name.c_str())));
+}
+
+template<>
+inline void Resultset::Get<ostring>(unsigned int index, ostring& value) const
+{
+    unsigned int size = 0;
+
+    const otext *data = Check(OCI_GetStringWithLength(*this, index, &size));
+
+    if (data)
+    {
+        value.assign(data, size);
+    }
+    else
+    {
+        value.clear();
+    }
+}
+
+template<>
+inline void Resultset::Get<ostring>(const ostring& name, ostring& value) const
+{
+    Get<ostring>(Check(OCI_GetColumnIndex(*this, name.c_str())), value);
+}
+
+template<>
+inline StringView Resultset::Get<StringView>(unsigned int index) const
+{
+    unsigned int size = 0;
+
+    const otext *data = Check(OCI_GetStringWithLength(*this, index, &size));
+
+    return StringView(data, size);
+}
+
+template<>
+inline StringView Resultset::Get<StringView>(const ostring& name) const
+{
+    return Get<StringView>(Check(OCI_GetColumnIndex(*this, name.c_str())));
 }
 
 template<>
@@ -6580,6 +7741,56 @@ T Resultset::Get(const ostring& name) const
     return T(Check(OCI_GetColl2(*this, name.c_str())), GetHandle());
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ColumnBatch
+ * --------------------------------------------------------------------------------------------- */
+
+inline ColumnBatch::ColumnBatch(const Resultset &resultset, unsigned int count) : _resultset(resultset), _count(count)
+{
+
+}
+
+inline unsigned int ColumnBatch::GetCount() const
+{
+    return _count;
+}
+
+inline Resultset ColumnBatch::GetResultset() const
+{
+    return _resultset;
+}
+
+inline const void * ColumnBatch::GetData(unsigned int index, unsigned int &stride) const
+{
+    return Check(OCI_GetBatchData(_resultset, index, &stride));
+}
+
+inline const short * ColumnBatch::GetIndicators(unsigned int index) const
+{
+    return Check(OCI_GetBatchIndicators(_resultset, index));
+}
+
+inline const unsigned short * ColumnBatch::GetLengths(unsigned int index) const
+{
+    return Check(OCI_GetBatchLengths(_resultset, index));
+}
+
+inline bool ColumnBatch::IsNull(unsigned int index, unsigned int row) const
+{
+    return row < _count && GetIndicators(index)[row] == -1;
+}
+
+template<class T>
+void ColumnBatch::GetNumbers(unsigned int index, std::vector<T> &values) const
+{
+    values.resize(_count);
+
+    if (_count > 0)
+    {
+        Check(OCI_GetBatchNumbers(_resultset, index, &values[0], static_cast<unsigned int>(NumericTypeResolver<T>::Value)));
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * Column
  * --------------------------------------------------------------------------------------------- */
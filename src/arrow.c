@@ -0,0 +1,1350 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ocilib_internal.h"
+
+#include <errno.h>
+
+#if defined(_WINDOWS)
+  #include <io.h>
+#else
+  #include <unistd.h>
+#endif
+
+/* ********************************************************************************************* *
+ *                             PRIVATE VARIABLES
+ * ********************************************************************************************* */
+
+/* exported types (index in ArrowTypes) */
+
+#define OCI_ARROW_BOOL                  0
+#define OCI_ARROW_INT16                 1
+#define OCI_ARROW_UINT16                2
+#define OCI_ARROW_INT32                 3
+#define OCI_ARROW_UINT32                4
+#define OCI_ARROW_INT64                 5
+#define OCI_ARROW_UINT64                6
+#define OCI_ARROW_FLOAT                 7
+#define OCI_ARROW_DOUBLE                8
+#define OCI_ARROW_UTF8                  9
+#define OCI_ARROW_BINARY                10
+#define OCI_ARROW_DATE                  11
+#define OCI_ARROW_TIMESTAMP             12
+#define OCI_ARROW_TIMESTAMP_UTC         13
+
+/* IPC flatbuffers schema values (Schema.fbs, Message.fbs) */
+
+#define OCI_ARROW_TYPE_INT              2
+#define OCI_ARROW_TYPE_FLOATING_POINT   3
+#define OCI_ARROW_TYPE_BINARY           4
+#define OCI_ARROW_TYPE_UTF8             5
+#define OCI_ARROW_TYPE_BOOL             6
+#define OCI_ARROW_TYPE_TIMESTAMP        10
+
+#define OCI_ARROW_PRECISION_SINGLE      1
+#define OCI_ARROW_PRECISION_DOUBLE      2
+
+#define OCI_ARROW_UNIT_SECOND           0
+#define OCI_ARROW_UNIT_MICROSECOND      2
+
+#define OCI_ARROW_METADATA_V5           4
+#define OCI_ARROW_HEADER_SCHEMA         1
+#define OCI_ARROW_HEADER_RECORD_BATCH   3
+
+#define OCI_ARROW_CONTINUATION          0xFFFFFFFF
+#define OCI_ARROW_ALIGNMENT             8
+
+#define OCI_ARROW_ALIGN(size)           (((size) + OCI_ARROW_ALIGNMENT - 1) & ~((size_t) OCI_ARROW_ALIGNMENT - 1))
+
+#define OCI_ARROW_MAX_FIELDS            8
+
+static const OCI_ArrowType ArrowTypes[] =
+{
+    { "b",       OCI_ARROW_TYPE_BOOL,           0,                          FALSE, 0, 0,               NULL  },
+    { "s",       OCI_ARROW_TYPE_INT,            16,                         TRUE,  2, OCI_NUM_SHORT,   NULL  },
+    { "S",       OCI_ARROW_TYPE_INT,            16,                         FALSE, 2, OCI_NUM_USHORT,  NULL  },
+    { "i",       OCI_ARROW_TYPE_INT,            32,                         TRUE,  4, OCI_NUM_INT,     NULL  },
+    { "I",       OCI_ARROW_TYPE_INT,            32,                         FALSE, 4, OCI_NUM_UINT,    NULL  },
+    { "l",       OCI_ARROW_TYPE_INT,            64,                         TRUE,  8, OCI_NUM_BIGINT,  NULL  },
+    { "L",       OCI_ARROW_TYPE_INT,            64,                         FALSE, 8, OCI_NUM_BIGUINT, NULL  },
+    { "f",       OCI_ARROW_TYPE_FLOATING_POINT, OCI_ARROW_PRECISION_SINGLE, FALSE, 4, OCI_NUM_FLOAT,   NULL  },
+    { "g",       OCI_ARROW_TYPE_FLOATING_POINT, OCI_ARROW_PRECISION_DOUBLE, FALSE, 8, OCI_NUM_DOUBLE,  NULL  },
+    { "u",       OCI_ARROW_TYPE_UTF8,           0,                          FALSE, 0, 0,               NULL  },
+    { "z",       OCI_ARROW_TYPE_BINARY,         0,                          FALSE, 0, 0,               NULL  },
+    { "tss:",    OCI_ARROW_TYPE_TIMESTAMP,      OCI_ARROW_UNIT_SECOND,      FALSE, 8, 0,               NULL  },
+    { "tsu:",    OCI_ARROW_TYPE_TIMESTAMP,      OCI_ARROW_UNIT_MICROSECOND, FALSE, 8, 0,               NULL  },
+    { "tsu:UTC", OCI_ARROW_TYPE_TIMESTAMP,      OCI_ARROW_UNIT_MICROSECOND, FALSE, 8, 0,               "UTC" }
+};
+
+/* the struct array wrapping the columns of a batch has no buffer of its own */
+
+static const void * ArrowStructBuffers[1] = { NULL };
+
+static const ub1 ArrowPadding[OCI_ARROW_ALIGNMENT] = { 0 };
+
+#define OCI_ARROW_CHECK_TYPES(rs)                                                               \
+                                                                                                \
+    for (ub4 i = 0; i < (rs)->nb_defs; i++)                                                     \
+    {                                                                                           \
+        if (NULL == OCI_ArrowGetType(&(rs)->defs[i]))                                           \
+        {                                                                                       \
+            OCI_RAISE_EXCEPTION(OCI_ExceptionDatatypeNotSupported((rs)->stmt->con, (rs)->stmt,  \
+                                                                  (rs)->defs[i].col.sqlcode))   \
+        }                                                                                       \
+    }                                                                                           \
+
+/* ********************************************************************************************* *
+ *                             PRIVATE FUNCTIONS
+ * ********************************************************************************************* */
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowGetType
+ * --------------------------------------------------------------------------------------------- */
+
+const OCI_ArrowType * OCI_ArrowGetType
+(
+    OCI_Define *def
+)
+{
+    int index = -1;
+
+    switch (def->col.datatype)
+    {
+        case OCI_CDT_NUMERIC:
+        {
+            switch (def->col.subtype)
+            {
+                case OCI_NUM_SHORT:   index = OCI_ARROW_INT16;  break;
+                case OCI_NUM_USHORT:  index = OCI_ARROW_UINT16; break;
+                case OCI_NUM_INT:     index = OCI_ARROW_INT32;  break;
+                case OCI_NUM_UINT:    index = OCI_ARROW_UINT32; break;
+                case OCI_NUM_BIGINT:  index = OCI_ARROW_INT64;  break;
+                case OCI_NUM_BIGUINT: index = OCI_ARROW_UINT64; break;
+                case OCI_NUM_FLOAT:   index = OCI_ARROW_FLOAT;  break;
+                case OCI_NUM_DOUBLE:  index = OCI_ARROW_DOUBLE; break;
+                case OCI_NUM_NUMBER:
+                {
+                    /* integers that always fit into 64 bits are kept exact */
+
+                    const boolean integer = (0 == def->col.scale) && (def->col.prec > 0) && (def->col.prec <= 18);
+
+                    index = integer ? OCI_ARROW_INT64 : OCI_ARROW_DOUBLE;
+                    break;
+                }
+            }
+            break;
+        }
+        case OCI_CDT_TEXT:
+        {
+            index = OCI_ARROW_UTF8;
+            break;
+        }
+        case OCI_CDT_RAW:
+        {
+            index = OCI_ARROW_BINARY;
+            break;
+        }
+        case OCI_CDT_BOOLEAN:
+        {
+            index = OCI_ARROW_BOOL;
+            break;
+        }
+        case OCI_CDT_DATETIME:
+        {
+            index = OCI_ARROW_DATE;
+            break;
+        }
+        case OCI_CDT_TIMESTAMP:
+        {
+            index = (OCI_TIMESTAMP == def->col.subtype) ? OCI_ARROW_TIMESTAMP : OCI_ARROW_TIMESTAMP_UTC;
+            break;
+        }
+    }
+
+    return (index >= 0) ? &ArrowTypes[index] : NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowEncodeUTF8
+ * --------------------------------------------------------------------------------------------- */
+
+size_t OCI_ArrowEncodeUTF8
+(
+    const void *src,
+    size_t      char_size,
+    size_t      len,
+    ub1        *dst
+)
+{
+    ub1 *ptr = dst;
+
+    /* dst must be able to hold 3 bytes per UTF-16 code unit and 4 bytes per UTF-32 code unit */
+
+    if (sizeof(char) == char_size)
+    {
+        memcpy(dst, src, len);
+
+        return len;
+    }
+
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int c = (sizeof(ub2) == char_size) ? ((const ub2 *) src)[i] : ((const ub4 *) src)[i];
+
+        /* UTF-16 surrogate pairs are combined, isolated surrogates are replaced */
+
+        if ((sizeof(ub2) == char_size) && (c >= 0xD800) && (c <= 0xDFFF))
+        {
+            const unsigned int low = (i + 1 < len) ? ((const ub2 *) src)[i + 1] : 0;
+
+            if ((c <= 0xDBFF) && (low >= 0xDC00) && (low <= 0xDFFF))
+            {
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                i++;
+            }
+            else
+            {
+                c = 0xFFFD;
+            }
+        }
+        else if ((c > 0x10FFFF) || ((c >= 0xD800) && (c <= 0xDFFF)))
+        {
+            c = 0xFFFD;
+        }
+
+        if (c < 0x80)
+        {
+            *ptr++ = (ub1) c;
+        }
+        else if (c < 0x800)
+        {
+            *ptr++ = (ub1) (0xC0 | (c >> 6));
+            *ptr++ = (ub1) (0x80 | (c & 0x3F));
+        }
+        else if (c < 0x10000)
+        {
+            *ptr++ = (ub1) (0xE0 | (c >> 12));
+            *ptr++ = (ub1) (0x80 | ((c >> 6) & 0x3F));
+            *ptr++ = (ub1) (0x80 | (c & 0x3F));
+        }
+        else
+        {
+            *ptr++ = (ub1) (0xF0 | (c >> 18));
+            *ptr++ = (ub1) (0x80 | ((c >> 12) & 0x3F));
+            *ptr++ = (ub1) (0x80 | ((c >> 6) & 0x3F));
+            *ptr++ = (ub1) (0x80 | (c & 0x3F));
+        }
+    }
+
+    return (size_t) (ptr - dst);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowGetName
+ * --------------------------------------------------------------------------------------------- */
+
+char * OCI_ArrowGetName
+(
+    const otext *name
+)
+{
+    const size_t len = name ? ostrlen(name) : 0;
+
+    char *str = (char *) OCI_MemAlloc(OCI_IPC_STRING, sizeof(otext) == sizeof(char) ? 1 : 4, len + 1, TRUE);
+
+    if (str && len > 0)
+    {
+        str[OCI_ArrowEncodeUTF8(name, sizeof(otext), len, (ub1 *) str)] = 0;
+    }
+
+    return str;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowGetDays
+ * --------------------------------------------------------------------------------------------- */
+
+big_int OCI_ArrowGetDays
+(
+    int year,
+    int month,
+    int day
+)
+{
+    /* number of days since 1970-01-01 in the proleptic Gregorian calendar */
+
+    const int     y   = year - (month <= 2);
+    const int     era = (y >= 0 ? y : y - 399) / 400;
+    const int     yoe = y - era * 400;
+    const int     doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int     doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return (big_int) era * 146097 + doe - 719468;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowColumnFree
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArrowColumnFree
+(
+    OCI_ArrowColumn *col
+)
+{
+    for (ub4 i = 0; i < col->nb_buffers; i++)
+    {
+        OCI_MemFree((void *) col->buffers[i]);
+
+        col->buffers[i] = NULL;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowColumnAlloc
+ * --------------------------------------------------------------------------------------------- */
+
+ub1 * OCI_ArrowColumnAlloc
+(
+    OCI_ArrowColumn *col,
+    ub4              index,
+    size_t           size
+)
+{
+    /* buffers are padded with zeros to the IPC alignment so they can be streamed as is */
+
+    ub1 *buf = (ub1 *) OCI_MemRealloc((void *) col->buffers[index], OCI_IPC_VOID,
+                                      OCI_ARROW_ALIGN(size) + OCI_ARROW_ALIGNMENT, 1, FALSE);
+
+    if (buf)
+    {
+        memset(buf + size, 0, OCI_ARROW_ALIGN(size) - size);
+
+        col->buffers[index] = buf;
+        col->sizes[index]   = size;
+    }
+
+    return buf;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowColumnBuild
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ArrowColumnBuild
+(
+    OCI_Define          *def,
+    const OCI_ArrowType *type,
+    ub4                  offset,
+    ub4                  count,
+    OCI_ArrowColumn     *col
+)
+{
+    OCI_Resultset *rs    = def->rs;
+    const OCIInd  *inds  = def->buf.inds + offset;
+    const size_t   bits  = ((size_t) count + 7) / 8;
+    ub1           *base  = NULL;
+    ub1           *valid = NULL;
+    ub1           *data  = NULL;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    memset(col, 0, sizeof(*col));
+
+    col->count      = count;
+    col->nb_buffers = (OCI_ARROW_TYPE_UTF8 == type->type_id || OCI_ARROW_TYPE_BINARY == type->type_id) ? 3 : 2;
+
+    base = ((ub1 *) def->buf.data) + (size_t) def->col.bufsize * offset;
+
+    /* validity bitmap, only exported when the batch holds null values */
+
+    valid = OCI_ArrowColumnAlloc(col, 0, bits);
+
+    OCI_STATUS = (NULL != valid);
+
+    if (OCI_STATUS)
+    {
+        memset(valid, 0, bits);
+
+        for (ub4 i = 0; i < count; i++)
+        {
+            if (OCI_IND_NULL == inds[i])
+            {
+                col->null_count++;
+            }
+            else
+            {
+                valid[i >> 3] |= (ub1) (1 << (i & 7));
+            }
+        }
+
+        if (0 == col->null_count)
+        {
+            OCI_MemFree(valid);
+
+            col->buffers[0] = NULL;
+            col->sizes[0]   = 0;
+        }
+    }
+
+    if (!OCI_STATUS)
+    {
+        /* nothing else to do */
+    }
+    else if (OCI_ARROW_TYPE_BOOL == type->type_id)
+    {
+        data = OCI_ArrowColumnAlloc(col, 1, bits);
+
+        OCI_STATUS = (NULL != data);
+
+        if (OCI_STATUS)
+        {
+            memset(data, 0, bits);
+
+            for (ub4 i = 0; i < count; i++)
+            {
+                if ((OCI_IND_NULL != inds[i]) && *(boolean *) (base + (size_t) def->col.bufsize * i))
+                {
+                    data[i >> 3] |= (ub1) (1 << (i & 7));
+                }
+            }
+        }
+    }
+    else if (type->width > 0)
+    {
+        data = OCI_ArrowColumnAlloc(col, 1, (size_t) type->width * count);
+
+        OCI_STATUS = (NULL != data);
+
+        if (!OCI_STATUS)
+        {
+            /* nothing else to do */
+        }
+        else if (OCI_CDT_NUMERIC == def->col.datatype)
+        {
+            /* native values with the exported layout are copied at once */
+
+            if ((def->col.subtype == type->subtype) && (def->col.bufsize == type->width))
+            {
+                memcpy(data, base, (size_t) type->width * count);
+            }
+            else
+            {
+                OCI_STATUS = OCI_TranslateNumericArray(rs->stmt->con, base, def->col.subtype, def->col.bufsize,
+                                                       (OCIInd *) inds, data, type->subtype, count);
+            }
+        }
+        else if (OCI_CDT_DATETIME == def->col.datatype)
+        {
+            big_int *values = (big_int *) data;
+
+            for (ub4 i = 0; i < count; i++)
+            {
+                const OCIDate *date = (const OCIDate *) (base + (size_t) def->col.bufsize * i);
+
+                values[i] = 0;
+
+                if (OCI_IND_NULL != inds[i])
+                {
+                    values[i] = OCI_ArrowGetDays(date->OCIDateYYYY, date->OCIDateMM, date->OCIDateDD) * 86400 +
+                                date->OCIDateTime.OCITimeHH * 3600 + date->OCIDateTime.OCITimeMI * 60 +
+                                date->OCIDateTime.OCITimeSS;
+                }
+            }
+        }
+        else if (OCI_CDT_TIMESTAMP == def->col.datatype)
+        {
+        #if OCI_VERSION_COMPILE >= OCI_9_0
+
+            big_int *values = (big_int *) data;
+
+            for (ub4 i = 0; (i < count) && OCI_STATUS; i++)
+            {
+                OCIDateTime *tmsp = (OCIDateTime *) def->buf.data[offset + i];
+
+                sb2 yr = 0;
+                ub1 mt = 0, dy = 0, hr = 0, mn = 0, sc = 0;
+                ub4 fs = 0;
+                sb1 tz_hour = 0, tz_min = 0;
+
+                values[i] = 0;
+
+                if (OCI_IND_NULL == inds[i])
+                {
+                    continue;
+                }
+
+                OCI_EXEC(OCIDateTimeGetDate((dvoid *) OCILib.env, rs->stmt->con->err, tmsp, &yr, &mt, &dy))
+                OCI_EXEC(OCIDateTimeGetTime((dvoid *) OCILib.env, rs->stmt->con->err, tmsp, &hr, &mn, &sc, &fs))
+
+                /* values with a time zone are exported as UTC instants */
+
+                if (type->timezone)
+                {
+                    OCI_EXEC(OCIDateTimeGetTimeZoneOffset((dvoid *) OCILib.env, rs->stmt->con->err, tmsp, &tz_hour, &tz_min))
+                }
+
+                values[i] = (OCI_ArrowGetDays(yr, mt, dy) * 86400 + hr * 3600 + mn * 60 + sc -
+                             tz_hour * 3600 - tz_min * 60) * 1000000 + fs / 1000;
+            }
+
+        #endif
+        }
+    }
+    else
+    {
+        /* variable size values : offsets and UTF-8 strings or raw bytes */
+
+        sb4   *offsets = (sb4 *) OCI_ArrowColumnAlloc(col, 1, sizeof(sb4) * ((size_t) count + 1));
+        size_t size    = 0;
+        size_t alloc   = 0;
+
+        OCI_STATUS = (NULL != offsets);
+
+        if (OCI_STATUS)
+        {
+            offsets[0] = 0;
+        }
+
+        for (ub4 i = 0; (i < count) && OCI_STATUS; i++)
+        {
+            const ub4 row  = offset + i;
+            const ub1 *src = base + (size_t) def->col.bufsize * i;
+
+            size_t char_size = 1;
+            size_t len       = 0;
+
+            if (OCI_IND_NULL == inds[i])
+            {
+                offsets[i + 1] = (sb4) size;
+                continue;
+            }
+
+            if (OCI_ARROW_TYPE_BINARY == type->type_id)
+            {
+                len = OCI_DefineGetLength(def, row);
+            }
+            else
+            {
+                /* rows already expanded to wide strings hold otext characters, others dbtext */
+
+                const boolean expanded = def->expanded && (def->expanded[row >> 3] & (ub1) (1 << (row & 7)));
+
+                char_size = expanded ? sizeof(otext) : sizeof(dbtext);
+
+                while ((len < def->col.bufsize / char_size) &&
+                       ((sizeof(ub1) == char_size) ? ((const ub1 *) src)[len] :
+                        (sizeof(ub2) == char_size) ? ((const ub2 *) src)[len] : ((const ub4 *) src)[len]))
+                {
+                    len++;
+                }
+            }
+
+            /* grow the values buffer for the worst case UTF-8 size */
+
+            if (size + len * (sizeof(char) == char_size ? 1 : char_size + 1) > alloc)
+            {
+                alloc = (size + len * 4) * 2;
+                data  = OCI_ArrowColumnAlloc(col, 2, alloc);
+
+                OCI_STATUS = (NULL != data);
+            }
+
+            if (OCI_STATUS)
+            {
+                size += OCI_ArrowEncodeUTF8(src, char_size, len, data + size);
+
+                offsets[i + 1] = (sb4) size;
+            }
+        }
+
+        if (OCI_STATUS)
+        {
+            /* the values buffer is always exported, even for empty or null values only */
+
+            data = OCI_ArrowColumnAlloc(col, 2, size);
+
+            OCI_STATUS = (NULL != data);
+        }
+    }
+
+    if (!OCI_STATUS)
+    {
+        OCI_ArrowColumnFree(col);
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowSchemaRelease
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArrowSchemaRelease
+(
+    struct ArrowSchema *schema
+)
+{
+    if (schema && schema->release)
+    {
+        if (schema->children)
+        {
+            /* children are allocated with the array of pointers to them */
+
+            for (int64_t i = 0; i < schema->n_children; i++)
+            {
+                if (schema->children[i]->release)
+                {
+                    schema->children[i]->release(schema->children[i]);
+                }
+            }
+
+            OCI_MemFree(schema->children);
+        }
+
+        OCI_MemFree((void *) schema->name);
+
+        schema->release = NULL;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowArrayRelease
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArrowArrayRelease
+(
+    struct ArrowArray *array
+)
+{
+    if (array && array->release)
+    {
+        if (array->children)
+        {
+            /* children are allocated with the array of pointers to them */
+
+            for (int64_t i = 0; i < array->n_children; i++)
+            {
+                if (array->children[i]->release)
+                {
+                    array->children[i]->release(array->children[i]);
+                }
+            }
+
+            OCI_MemFree(array->children);
+        }
+
+        if (array->private_data)
+        {
+            OCI_ArrowColumnFree((OCI_ArrowColumn *) array->private_data);
+            OCI_MemFree(array->private_data);
+        }
+
+        array->release = NULL;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageAlloc
+ * --------------------------------------------------------------------------------------------- */
+
+size_t OCI_ArrowMessageAlloc
+(
+    OCI_ArrowMessage *msg,
+    size_t            size,
+    size_t            align,
+    size_t            bias
+)
+{
+    /* returns the position of a zeroed block of the given size, with (position + bias) aligned */
+
+    size_t pos = msg->size;
+
+    while ((pos + bias) % align)
+    {
+        pos++;
+    }
+
+    if (msg->data && (pos + size > msg->alloc))
+    {
+        const size_t alloc = (pos + size) * 2;
+
+        /* OCI_MemRealloc() releases the current block when it cannot be grown */
+
+        ub1 *data = (ub1 *) OCI_MemRealloc(msg->data, OCI_IPC_VOID, alloc, 1, FALSE);
+
+        msg->data  = data;
+        msg->alloc = data ? alloc : 0;
+        msg->size  = data ? msg->size : 0;
+    }
+
+    if (msg->data)
+    {
+        memset(msg->data + msg->size, 0, pos + size - msg->size);
+
+        msg->size = pos + size;
+    }
+
+    return pos;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessagePut
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArrowMessagePut
+(
+    OCI_ArrowMessage *msg,
+    size_t            pos,
+    big_uint          value,
+    size_t            size
+)
+{
+    /* flatbuffers scalars are little endian */
+
+    if (msg->data && (pos + size <= msg->size))
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            msg->data[pos + i] = (ub1) (value >> (i * 8));
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageLink
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArrowMessageLink
+(
+    OCI_ArrowMessage *msg,
+    size_t            field,
+    size_t            target
+)
+{
+    /* objects are always written after the field referencing them */
+
+    OCI_ArrowMessagePut(msg, field, (big_uint) (target - field), sizeof(ub4));
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageTable
+ * --------------------------------------------------------------------------------------------- */
+
+size_t OCI_ArrowMessageTable
+(
+    OCI_ArrowMessage *msg,
+    ub2               count,
+    const ub1        *sizes,
+    size_t           *fields
+)
+{
+    ub2    offsets[OCI_ARROW_MAX_FIELDS];
+    ub2    size   = sizeof(sb4);
+    size_t vtable = 0;
+    size_t table  = 0;
+
+    /* fields are laid out in order after the vtable offset, each one aligned on its size */
+
+    for (ub2 i = 0; i < count; i++)
+    {
+        offsets[i] = 0;
+
+        if (sizes[i] > 0)
+        {
+            size = (ub2) ((size + sizes[i] - 1) & ~(sizes[i] - 1));
+
+            offsets[i] = size;
+
+            size += sizes[i];
+        }
+    }
+
+    /* the vtable is written first and referenced backward from the table */
+
+    vtable = OCI_ArrowMessageAlloc(msg, sizeof(ub2) * (2 + (size_t) count), sizeof(ub2), 0);
+    table  = OCI_ArrowMessageAlloc(msg, size, OCI_ARROW_ALIGNMENT, 0);
+
+    OCI_ArrowMessagePut(msg, vtable, sizeof(ub2) * (2 + (size_t) count), sizeof(ub2));
+    OCI_ArrowMessagePut(msg, vtable + sizeof(ub2), size, sizeof(ub2));
+
+    for (ub2 i = 0; i < count; i++)
+    {
+        OCI_ArrowMessagePut(msg, vtable + sizeof(ub2) * (2 + (size_t) i), offsets[i], sizeof(ub2));
+
+        fields[i] = offsets[i] ? table + offsets[i] : 0;
+    }
+
+    OCI_ArrowMessagePut(msg, table, (big_uint) (table - vtable), sizeof(sb4));
+
+    return table;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageVector
+ * --------------------------------------------------------------------------------------------- */
+
+size_t OCI_ArrowMessageVector
+(
+    OCI_ArrowMessage *msg,
+    ub4               count,
+    size_t            elem_size
+)
+{
+    /* the vector length immediately precedes its elements that are aligned on their size */
+
+    const size_t align = (elem_size > sizeof(ub4)) ? OCI_ARROW_ALIGNMENT : sizeof(ub4);
+
+    const size_t pos = OCI_ArrowMessageAlloc(msg, sizeof(ub4) + elem_size * count, align, sizeof(ub4));
+
+    OCI_ArrowMessagePut(msg, pos, count, sizeof(ub4));
+
+    return pos;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageString
+ * --------------------------------------------------------------------------------------------- */
+
+size_t OCI_ArrowMessageString
+(
+    OCI_ArrowMessage *msg,
+    const char       *str
+)
+{
+    const size_t len = strlen(str);
+    const size_t pos = OCI_ArrowMessageAlloc(msg, sizeof(ub4) + len + 1, sizeof(ub4), 0);
+
+    OCI_ArrowMessagePut(msg, pos, len, sizeof(ub4));
+
+    if (msg->data)
+    {
+        memcpy(msg->data + pos + sizeof(ub4), str, len);
+    }
+
+    return pos;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageHeader
+ * --------------------------------------------------------------------------------------------- */
+
+size_t OCI_ArrowMessageHeader
+(
+    OCI_ArrowMessage *msg,
+    ub1               type,
+    big_uint          body_size
+)
+{
+    /* Message { version, header_type, header, bodyLength } */
+
+    static const ub1 sizes[] = { sizeof(ub2), sizeof(ub1), sizeof(ub4), sizeof(big_int) };
+
+    size_t fields[4];
+
+    const size_t root  = OCI_ArrowMessageAlloc(msg, sizeof(ub4), sizeof(ub4), 0);
+    const size_t table = OCI_ArrowMessageTable(msg, 4, sizes, fields);
+
+    OCI_ArrowMessageLink(msg, root, table);
+
+    OCI_ArrowMessagePut(msg, fields[0], OCI_ARROW_METADATA_V5, sizeof(ub2));
+    OCI_ArrowMessagePut(msg, fields[1], type, sizeof(ub1));
+    OCI_ArrowMessagePut(msg, fields[3], body_size, sizeof(big_int));
+
+    /* the caller links the header field to the schema or record batch table */
+
+    return fields[2];
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageSchema
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArrowMessageSchema
+(
+    OCI_ArrowMessage *msg,
+    OCI_Resultset    *rs
+)
+{
+    /* Schema { endianness, fields } */
+
+    static const ub1 schema_sizes[] = { sizeof(ub2), sizeof(ub4) };
+
+    /* Field { name, nullable, type_type, type, dictionary, children } */
+
+    static const ub1 field_sizes[] = { sizeof(ub4), sizeof(ub1), sizeof(ub1), sizeof(ub4), 0, sizeof(ub4) };
+
+    /* Int { bitWidth, is_signed }, FloatingPoint { precision }, Timestamp { unit, timezone } */
+
+    static const ub1 int_sizes[] = { sizeof(sb4), sizeof(ub1) };
+    static const ub1 fp_sizes[]  = { sizeof(ub2) };
+    static const ub1 ts_sizes[]  = { sizeof(ub2), sizeof(ub4) };
+
+    const ub2 endian = 1;
+
+    size_t schema_fields[2];
+    size_t header = OCI_ArrowMessageHeader(msg, OCI_ARROW_HEADER_SCHEMA, 0);
+    size_t schema = OCI_ArrowMessageTable(msg, 2, schema_sizes, schema_fields);
+    size_t vector = 0;
+
+    OCI_ArrowMessageLink(msg, header, schema);
+
+    OCI_ArrowMessagePut(msg, schema_fields[0], (*(const ub1 *) &endian) ? 0 : 1, sizeof(ub2));
+
+    vector = OCI_ArrowMessageVector(msg, rs->nb_defs, sizeof(ub4));
+
+    OCI_ArrowMessageLink(msg, schema_fields[1], vector);
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define          *def  = &rs->defs[i];
+        const OCI_ArrowType *type = OCI_ArrowGetType(def);
+
+        size_t fields[6], type_fields[2];
+        size_t table = OCI_ArrowMessageTable(msg, 6, field_sizes, fields);
+        char  *name  = OCI_ArrowGetName(def->col.name);
+
+        OCI_ArrowMessageLink(msg, vector + sizeof(ub4) * (1 + (size_t) i), table);
+
+        OCI_ArrowMessageLink(msg, fields[0], OCI_ArrowMessageString(msg, name ? name : ""));
+        OCI_ArrowMessagePut(msg, fields[1], def->col.nullable ? 1 : 0, sizeof(ub1));
+        OCI_ArrowMessagePut(msg, fields[2], type->type_id, sizeof(ub1));
+
+        OCI_MemFree(name);
+
+        switch (type->type_id)
+        {
+            case OCI_ARROW_TYPE_INT:
+            {
+                OCI_ArrowMessageLink(msg, fields[3], OCI_ArrowMessageTable(msg, 2, int_sizes, type_fields));
+                OCI_ArrowMessagePut(msg, type_fields[0], type->param, sizeof(sb4));
+                OCI_ArrowMessagePut(msg, type_fields[1], type->is_signed, sizeof(ub1));
+                break;
+            }
+            case OCI_ARROW_TYPE_FLOATING_POINT:
+            {
+                OCI_ArrowMessageLink(msg, fields[3], OCI_ArrowMessageTable(msg, 1, fp_sizes, type_fields));
+                OCI_ArrowMessagePut(msg, type_fields[0], type->param, sizeof(ub2));
+                break;
+            }
+            case OCI_ARROW_TYPE_TIMESTAMP:
+            {
+                OCI_ArrowMessageLink(msg, fields[3], OCI_ArrowMessageTable(msg, type->timezone ? 2 : 1,
+                                                                           ts_sizes, type_fields));
+                OCI_ArrowMessagePut(msg, type_fields[0], type->param, sizeof(ub2));
+
+                if (type->timezone)
+                {
+                    OCI_ArrowMessageLink(msg, type_fields[1], OCI_ArrowMessageString(msg, type->timezone));
+                }
+                break;
+            }
+            default:
+            {
+                /* Utf8, Binary and Bool tables have no fields */
+
+                OCI_ArrowMessageLink(msg, fields[3], OCI_ArrowMessageTable(msg, 0, NULL, type_fields));
+                break;
+            }
+        }
+
+        /* columns have no children but readers expect the vector */
+
+        OCI_ArrowMessageLink(msg, fields[5], OCI_ArrowMessageVector(msg, 0, sizeof(ub4)));
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowMessageRecordBatch
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArrowMessageRecordBatch
+(
+    OCI_ArrowMessage *msg,
+    OCI_ArrowColumn  *cols,
+    ub4               nb_cols,
+    ub4               count
+)
+{
+    /* RecordBatch { length, nodes, buffers } */
+
+    static const ub1 sizes[] = { sizeof(big_int), sizeof(ub4), sizeof(ub4) };
+
+    size_t fields[3];
+    size_t header  = 0;
+    size_t table   = 0;
+    size_t nodes   = 0;
+    size_t buffers = 0;
+    size_t body    = 0;
+    ub4    nb_bufs = 0;
+
+    for (ub4 i = 0; i < nb_cols; i++)
+    {
+        nb_bufs += cols[i].nb_buffers;
+
+        for (ub4 j = 0; j < cols[i].nb_buffers; j++)
+        {
+            body += OCI_ARROW_ALIGN(cols[i].sizes[j]);
+        }
+    }
+
+    header = OCI_ArrowMessageHeader(msg, OCI_ARROW_HEADER_RECORD_BATCH, body);
+    table  = OCI_ArrowMessageTable(msg, 3, sizes, fields);
+
+    OCI_ArrowMessageLink(msg, header, table);
+    OCI_ArrowMessagePut(msg, fields[0], count, sizeof(big_int));
+
+    /* FieldNode { length, null_count } and Buffer { offset, length } structures */
+
+    nodes = OCI_ArrowMessageVector(msg, nb_cols, 2 * sizeof(big_int));
+    OCI_ArrowMessageLink(msg, fields[1], nodes);
+
+    buffers = OCI_ArrowMessageVector(msg, nb_bufs, 2 * sizeof(big_int));
+    OCI_ArrowMessageLink(msg, fields[2], buffers);
+
+    nodes   += sizeof(ub4);
+    buffers += sizeof(ub4);
+    body     = 0;
+
+    for (ub4 i = 0; i < nb_cols; i++)
+    {
+        OCI_ArrowMessagePut(msg, nodes, cols[i].count, sizeof(big_int));
+        OCI_ArrowMessagePut(msg, nodes + sizeof(big_int), cols[i].null_count, sizeof(big_int));
+
+        nodes += 2 * sizeof(big_int);
+
+        for (ub4 j = 0; j < cols[i].nb_buffers; j++)
+        {
+            OCI_ArrowMessagePut(msg, buffers, body, sizeof(big_int));
+            OCI_ArrowMessagePut(msg, buffers + sizeof(big_int), cols[i].sizes[j], sizeof(big_int));
+
+            buffers += 2 * sizeof(big_int);
+            body    += OCI_ARROW_ALIGN(cols[i].sizes[j]);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowStreamWrite
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ArrowStreamWrite
+(
+    OCI_Resultset *rs,
+    int            fd,
+    const void    *data,
+    size_t         size
+)
+{
+    const ub1 *ptr = (const ub1 *) data;
+
+    while (size > 0)
+    {
+    #if defined(_WINDOWS)
+        const int res = _write(fd, ptr, (unsigned int) min(size, INT_MAX));
+    #else
+        const ssize_t res = write(fd, ptr, size);
+    #endif
+
+        if (res < 0 && EINTR == errno)
+        {
+            continue;
+        }
+
+        if (res <= 0)
+        {
+            OCI_ExceptionStreamWrite(rs->stmt, errno);
+
+            return FALSE;
+        }
+
+        ptr  += res;
+        size -= (size_t) res;
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArrowStreamMessage
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ArrowStreamMessage
+(
+    OCI_Resultset    *rs,
+    int               fd,
+    OCI_ArrowMessage *msg,
+    OCI_ArrowColumn  *cols,
+    ub4               nb_cols
+)
+{
+    /* encapsulated message : continuation marker, metadata size, metadata and body */
+
+    const size_t meta_size = OCI_ARROW_ALIGN(msg->size);
+
+    ub1 prefix[8];
+
+    boolean res = (NULL != msg->data);
+
+    for (size_t i = 0; i < sizeof(ub4); i++)
+    {
+        prefix[i]                = (ub1) (OCI_ARROW_CONTINUATION >> (i * 8));
+        prefix[i + sizeof(ub4)]  = (ub1) (meta_size >> (i * 8));
+    }
+
+    res = res && OCI_ArrowStreamWrite(rs, fd, prefix, sizeof(prefix));
+    res = res && OCI_ArrowStreamWrite(rs, fd, msg->data, msg->size);
+    res = res && OCI_ArrowStreamWrite(rs, fd, ArrowPadding, meta_size - msg->size);
+
+    /* column buffers are already padded */
+
+    for (ub4 i = 0; res && i < nb_cols; i++)
+    {
+        for (ub4 j = 0; res && j < cols[i].nb_buffers; j++)
+        {
+            if (cols[i].buffers[j])
+            {
+                res = OCI_ArrowStreamWrite(rs, fd, cols[i].buffers[j], OCI_ARROW_ALIGN(cols[i].sizes[j]));
+            }
+        }
+    }
+
+    return res;
+}
+
+/* ********************************************************************************************* *
+ *                            PUBLIC FUNCTIONS
+ * ********************************************************************************************* */
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetArrowSchema
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetArrowSchema
+(
+    OCI_Resultset      *rs,
+    struct ArrowSchema *schema
+)
+{
+    struct ArrowSchema **children = NULL;
+
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CALL_CHECK_PTR(OCI_IPC_VOID, schema)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    memset(schema, 0, sizeof(*schema));
+
+    OCI_ARROW_CHECK_TYPES(rs)
+
+    /* children are allocated in the same block than the array of pointers to them */
+
+    children = (struct ArrowSchema **) OCI_MemAlloc(OCI_IPC_VOID, sizeof(*children) + sizeof(**children),
+                                                    (size_t) rs->nb_defs + 1, TRUE);
+
+    OCI_STATUS = (NULL != children);
+
+    if (OCI_STATUS)
+    {
+        struct ArrowSchema *fields = (struct ArrowSchema *) (children + rs->nb_defs + 1);
+
+        schema->format     = "+s";
+        schema->name       = NULL;
+        schema->n_children = rs->nb_defs;
+        schema->children   = children;
+        schema->release    = OCI_ArrowSchemaRelease;
+
+        for (ub4 i = 0; i < rs->nb_defs; i++)
+        {
+            OCI_Define *def = &rs->defs[i];
+
+            children[i] = &fields[i];
+
+            fields[i].format  = OCI_ArrowGetType(def)->format;
+            fields[i].name    = OCI_ArrowGetName(def->col.name);
+            fields[i].flags   = def->col.nullable ? ARROW_FLAG_NULLABLE : 0;
+            fields[i].release = OCI_ArrowSchemaRelease;
+        }
+
+        OCI_RETVAL = OCI_STATUS;
+    }
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchArrowBatch
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_FetchArrowBatch
+(
+    OCI_Resultset     *rs,
+    struct ArrowArray *array
+)
+{
+    struct ArrowArray **children = NULL;
+    unsigned int        rows     = 0;
+
+    OCI_CALL_ENTER(unsigned int, 0)
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CALL_CHECK_PTR(OCI_IPC_VOID, array)
+    OCI_CALL_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    memset(array, 0, sizeof(*array));
+
+    OCI_ARROW_CHECK_TYPES(rs)
+
+    if (OCI_FetchBatch(rs, &rows))
+    {
+        children = (struct ArrowArray **) OCI_MemAlloc(OCI_IPC_VOID, sizeof(*children) + sizeof(**children),
+                                                       (size_t) rs->nb_defs + 1, TRUE);
+
+        OCI_STATUS = (NULL != children);
+
+        if (OCI_STATUS)
+        {
+            struct ArrowArray *columns = (struct ArrowArray *) (children + rs->nb_defs + 1);
+
+            array->length     = rows;
+            array->n_buffers  = 1;
+            array->buffers    = (const void **) ArrowStructBuffers;
+            array->n_children = 0;
+            array->children   = children;
+            array->release    = OCI_ArrowArrayRelease;
+
+            for (ub4 i = 0; (i < rs->nb_defs) && OCI_STATUS; i++)
+            {
+                OCI_ArrowColumn *col = NULL;
+
+                OCI_ALLOCATE_DATA(OCI_IPC_VOID, col, 1)
+
+                OCI_STATUS = OCI_STATUS && OCI_ArrowColumnBuild(&rs->defs[i], OCI_ArrowGetType(&rs->defs[i]),
+                                                                rs->batch_offset, rows, col);
+
+                if (!OCI_STATUS)
+                {
+                    OCI_MemFree(col);
+                    break;
+                }
+
+                children[i] = &columns[i];
+
+                columns[i].length       = col->count;
+                columns[i].null_count   = col->null_count;
+                columns[i].n_buffers    = col->nb_buffers;
+                columns[i].buffers      = col->buffers;
+                columns[i].private_data = col;
+                columns[i].release      = OCI_ArrowArrayRelease;
+
+                array->n_children++;
+            }
+
+            if (!OCI_STATUS)
+            {
+                OCI_ArrowArrayRelease(array);
+            }
+        }
+
+        OCI_RETVAL = OCI_STATUS ? rows : 0;
+    }
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ExportArrowStream
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_ExportArrowStream
+(
+    OCI_Resultset *rs,
+    int            fd
+)
+{
+    static const ub1 eos[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0 };
+
+    OCI_ArrowMessage msg;
+    OCI_ArrowColumn *cols = NULL;
+    unsigned int     rows = 0;
+
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CALL_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    memset(&msg, 0, sizeof(msg));
+
+    OCI_ARROW_CHECK_TYPES(rs)
+
+    /* the metadata buffer is reused by all messages */
+
+    msg.alloc = 256 + (size_t) rs->nb_defs * 256;
+
+    OCI_ALLOCATE_BUFFER(OCI_IPC_VOID, msg.data, msg.alloc, 1)
+    OCI_ALLOCATE_DATA(OCI_IPC_VOID, cols, rs->nb_defs + 1)
+
+    if (OCI_STATUS)
+    {
+        OCI_ArrowMessageSchema(&msg, rs);
+
+        OCI_STATUS = OCI_ArrowStreamMessage(rs, fd, &msg, NULL, 0);
+    }
+
+    /* one record batch per array of rows */
+
+    while (OCI_STATUS && OCI_FetchBatch(rs, &rows))
+    {
+        ub4 nb_cols = 0;
+
+        for (ub4 i = 0; (i < rs->nb_defs) && OCI_STATUS; i++)
+        {
+            OCI_STATUS = OCI_ArrowColumnBuild(&rs->defs[i], OCI_ArrowGetType(&rs->defs[i]),
+                                              rs->batch_offset, rows, &cols[i]);
+
+            nb_cols += OCI_STATUS ? 1 : 0;
+        }
+
+        if (OCI_STATUS)
+        {
+            msg.size = 0;
+
+            OCI_ArrowMessageRecordBatch(&msg, cols, nb_cols, rows);
+
+            OCI_STATUS = OCI_ArrowStreamMessage(rs, fd, &msg, cols, nb_cols);
+        }
+
+        for (ub4 i = 0; i < nb_cols; i++)
+        {
+            OCI_ArrowColumnFree(&cols[i]);
+        }
+    }
+
+    /* a fetch failure has already raised its error and leaves the stream unterminated */
+
+    OCI_STATUS = OCI_STATUS && rs->eof && OCI_ArrowStreamWrite(rs, fd, eos, sizeof(eos));
+
+    OCI_FREE(cols)
+    OCI_FREE(msg.data)
+
+    OCI_RETVAL = OCI_STATUS;
+
+    OCI_CALL_EXIT()
+}
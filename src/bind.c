@@ -461,6 +461,7 @@ OCI_Bind* OCI_BindCreate
         bnd->typinf    = typinf;
         bnd->csfrm     = OCI_CSF_NONE;
         bnd->direction = OCI_BDM_IN_OUT;
+        bnd->dirty     = TRUE;
 
         if (!bnd->name)
         {
@@ -938,6 +939,8 @@ boolean OCI_BindSetNullIndicator
         bnd->buffer.inds[position - 1] = value;
     }
 
+    bnd->dirty = TRUE;
+
     return TRUE;
 }
 
@@ -1075,6 +1078,8 @@ boolean OCI_API OCI_BindSetDataSizeAtPos
 
         ((ub2 *) bnd->buffer.lens)[position-1] = (ub2) size;
 
+        bnd->dirty = TRUE;
+
         OCI_RETVAL = TRUE;
     }
 
@@ -1269,7 +1274,17 @@ boolean OCI_API OCI_BindSetDirection
     unsigned int direction
 )
 {
-    OCI_SET_PROP_ENUM(ub1, OCI_IPC_BIND, bnd, direction, direction, BindDirectionValues, OTEXT("Direction"), bnd->stmt->con, bnd->stmt, bnd->stmt->con->err)
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_PTR(OCI_IPC_BIND, bnd)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(bnd->stmt)
+    OCI_CALL_CHECK_ENUM_VALUE(bnd->stmt->con, bnd->stmt, direction, BindDirectionValues, OTEXT("Direction"))
+
+    bnd->direction = (ub1) direction;
+    bnd->dirty     = TRUE;
+
+    OCI_RETVAL = OCI_STATUS;
+
+    OCI_CALL_EXIT()
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -1284,6 +1299,30 @@ unsigned int OCI_API OCI_BindGetDirection
     OCI_GET_PROP(unsigned int, OCI_UNKNOWN, OCI_IPC_BIND, bnd, direction, bnd->stmt->con, bnd->stmt, bnd->stmt->con->err)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindSetDirty
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_BindSetDirty
+(
+    OCI_Bind *bnd
+)
+{
+    OCI_SET_PROP(boolean, OCI_IPC_BIND, bnd, dirty, TRUE, bnd->stmt->con, bnd->stmt, bnd->stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindIsDirty
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_BindIsDirty
+(
+    OCI_Bind *bnd
+)
+{
+    OCI_GET_PROP(boolean, FALSE, OCI_IPC_BIND, bnd, dirty, bnd->stmt->con, bnd->stmt, bnd->stmt->con->err)
+}
+
 /* --------------------------------------------------------------------------------------------- *
 * OCI_BindGetAllocationMode
 * --------------------------------------------------------------------------------------------- */
@@ -102,21 +102,18 @@ boolean OCI_ColumnGetAttrInfo
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OCI_ColumnDescribe
+ * OCI_ColumnGetAttributes
  * --------------------------------------------------------------------------------------------- */
 
-boolean OCI_ColumnDescribe
+static boolean OCI_ColumnGetAttributes
 (
     OCI_Column     *col,
     OCI_Connection *con,
     OCI_Statement  *stmt,
-    void           *handle,
-    int             index,
+    void           *param,
     int             ptype
 )
 {
-    void *param = NULL;
-
     OCI_CALL_DECLARE_CONTEXT(TRUE)
 
     if (stmt)
@@ -128,19 +125,6 @@ boolean OCI_ColumnDescribe
         OCI_CALL_CONTEXT_SET_FROM_CONN(con);
     }
 
-    /* get descriptor */
-
-    if (OCI_DESC_COLLECTION == ptype)
-    {
-        OCI_GET_ATTRIB(OCI_DTYPE_PARAM, OCI_ATTR_COLLECTION_ELEMENT, handle, &param, NULL)
-    }
-    else
-    {
-        const ub4 htype = (OCI_DESC_RESULTSET == ptype) ? OCI_HTYPE_STMT : OCI_DTYPE_PARAM;
-
-        OCI_EXEC(OCIParamGet((dvoid *) handle, htype,  con->err, (void**) &param, (ub4) index))
-    }
-
     /* sql code */
     OCI_GET_ATTRIB(OCI_DTYPE_PARAM, OCI_ATTR_DATA_TYPE, param, &col->sqlcode, NULL)
 
@@ -290,6 +274,53 @@ boolean OCI_ColumnDescribe
         col->nullable = TRUE;
     }
 
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ColumnDescribe
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ColumnDescribe
+(
+    OCI_Column     *col,
+    OCI_Connection *con,
+    OCI_Statement  *stmt,
+    void           *handle,
+    int             index,
+    int             ptype
+)
+{
+    void *param = NULL;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+
+    if (stmt)
+    {
+        OCI_CALL_CONTEXT_SET_FROM_STMT(stmt);
+    }
+    else
+    {
+        OCI_CALL_CONTEXT_SET_FROM_CONN(con);
+    }
+
+    /* get descriptor */
+
+    if (OCI_DESC_COLLECTION == ptype)
+    {
+        OCI_GET_ATTRIB(OCI_DTYPE_PARAM, OCI_ATTR_COLLECTION_ELEMENT, handle, &param, NULL)
+    }
+    else
+    {
+        const ub4 htype = (OCI_DESC_RESULTSET == ptype) ? OCI_HTYPE_STMT : OCI_DTYPE_PARAM;
+
+        OCI_EXEC(OCIParamGet((dvoid *) handle, htype,  con->err, (void**) &param, (ub4) index))
+    }
+
+    /* attributes */
+
+    OCI_STATUS = OCI_STATUS && OCI_ColumnGetAttributes(col, con, stmt, param, ptype);
+
     /* name */
 
     if (OCI_STATUS)
@@ -422,6 +453,109 @@ boolean OCI_ColumnDescribe
     return OCI_STATUS;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ColumnCacheGet
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_ColumnCache * OCI_ColumnCacheGet
+(
+    OCI_Statement *stmt,
+    ub4            count,
+    boolean       *valid
+)
+{
+    OCI_ColumnCache *cache = stmt->cols_cache;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(stmt);
+
+    *valid = FALSE;
+
+    /* the cached description is reused for the same OCI statement handle and SQL text with
+       the same number of columns. Select list items are not described again, thus a column
+       type altered by a DDL statement without changing the number of columns is not detected
+       while the same OCI statement handle is used */
+
+    if (cache && stmt->sql && (cache->handle == stmt->stmt) &&
+        (cache->count == count) && (0 == ostrcmp(cache->sql, stmt->sql)))
+    {
+        *valid = TRUE;
+    }
+
+    if (*valid)
+    {
+        return cache;
+    }
+
+    /* otherwise, prepare a new cache to be filled while describing the select list */
+
+    OCI_ColumnCacheFree(stmt);
+
+    cache = NULL;
+
+    if (stmt->sql && (count > 0))
+    {
+        OCI_ALLOCATE_DATA(OCI_IPC_COLUMN_CACHE, cache, 1)
+        OCI_ALLOCATE_DATA(OCI_IPC_COLUMN, cache->cols, count)
+
+        if (OCI_STATUS)
+        {
+            cache->sql    = ostrdup(stmt->sql);
+            cache->handle = stmt->stmt;
+            cache->count  = count;
+
+            OCI_STATUS = (NULL != cache->sql);
+        }
+
+        stmt->cols_cache = cache;
+
+        if (!OCI_STATUS)
+        {
+            OCI_ColumnCacheFree(stmt);
+
+            cache = NULL;
+        }
+    }
+
+    return cache;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ColumnCacheFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ColumnCacheFree
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_ColumnCache *cache = stmt->cols_cache;
+
+    OCI_CHECK(NULL == cache, TRUE)
+
+    if (cache->cols)
+    {
+        for (ub4 i = 0; i < cache->count; i++)
+        {
+            OCI_FREE(cache->cols[i].name)
+        }
+
+        OCI_FREE(cache->cols)
+    }
+
+    if (cache->map)
+    {
+        OCI_HashFree(cache->map);
+    }
+
+    OCI_FREE(cache->sql)
+    OCI_FREE(cache)
+
+    stmt->cols_cache = NULL;
+
+    return TRUE;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ColumnMap
  * --------------------------------------------------------------------------------------------- */
@@ -121,6 +121,8 @@ OCI_Connection * OCI_ConnectionAllocate
             con->pool     = pool;
             con->sess_tag = NULL;
 
+            con->stmt_cache.limit = OCI_CACHED_STMT_LIMIT;
+
             if (con->pool)
             {
                 con->db   = (otext *) db;
@@ -786,6 +788,12 @@ boolean OCI_ConnectionLogOff
     OCI_ListForEach(con->stmts, (POCI_LIST_FOR_EACH) OCI_StatementClose);
     OCI_ListClear(con->stmts);
 
+    /* idle cached statements have been freed with the others */
+
+    OCI_FREE(con->stmt_cache.entries)
+
+    con->stmt_cache.count = 0;
+
     /* free all type info objects */
 
     OCI_ListForEach(con->tinfs, (POCI_LIST_FOR_EACH) OCI_TypeInfoClose);
@@ -2352,6 +2360,37 @@ boolean OCI_API OCI_SetStatementCacheSize
     OCI_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetCachedStatementLimit
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetCachedStatementLimit
+(
+    OCI_Connection  *con
+)
+{
+    OCI_GET_PROP(unsigned int, 0, OCI_IPC_CONNECTION, con, stmt_cache.limit, con, NULL, con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetCachedStatementLimit
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetCachedStatementLimit
+(
+    OCI_Connection  *con,
+    unsigned int     value
+)
+{
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_PTR(OCI_IPC_CONNECTION, con)
+    OCI_CALL_CONTEXT_SET_FROM_CONN(con)
+
+    OCI_RETVAL = OCI_STATUS = OCI_StatementCacheSetLimit(con, value);
+
+    OCI_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_GetDefaultLobPrefetchSize
  * --------------------------------------------------------------------------------------------- */
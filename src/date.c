@@ -611,6 +611,7 @@ boolean OCI_API OCI_DateToText
     dbtext *dbstr2  = NULL;
     int     dbsize1 = size * (int) sizeof(otext);
     int     dbsize2 = -1;
+    int     len     = 0;
   
     OCI_CALL_ENTER(boolean, FALSE)
     OCI_CALL_CHECK_PTR(OCI_IPC_DATE, date)
@@ -636,14 +637,14 @@ boolean OCI_API OCI_DateToText
                       (ub4*) &dbsize1, (oratext *) dbstr1)
     )
 
-    OCI_StringCopyOracleStringToNativeString(dbstr1, str, dbcharcount(dbsize1));
+    len = OCI_StringCopyOracleStringToNativeString(dbstr1, str, dbcharcount(dbsize1));
 
     OCI_StringReleaseOracleString(dbstr1);
     OCI_StringReleaseOracleString(dbstr2);
 
     /* set null string terminator */
 
-    str[dbcharcount(dbsize1)] = 0;
+    str[len] = 0;
 
     OCI_RETVAL = OCI_STATUS;
 
@@ -76,19 +76,11 @@ int OCI_GetDefineIndex
 
     OCI_CHECK(NULL == rs->map, -1);
 
-    he = OCI_HashLookup(rs->map, name, FALSE);
+    he = OCI_HashFind(rs->map, name);
 
-    while (he)
+    if (he)
     {
-        /* no more entries or key matched => so we got it ! */
-
-        if (!he->next || 0 == ostrcasecmp(he->key, name))
-        {
-            index = he->values->value.num;
-            break;
-        }
-
-        he = he->next;
+        index = he->values->value.num;
     }
 
     if (index < 0)
@@ -132,11 +124,104 @@ void * OCI_DefineGetData
         {
             /* scalar types */
 
-            return (((ub1 *) (def->buf.data)) + (size_t) (def->col.bufsize * (def->rs->row_cur-1)));
+            const ub4 row = def->rs->row_cur - 1;
+
+            /* strings are expanded to wide strings on first access */
+
+            if (def->expanded)
+            {
+                OCI_DefineExpandStrings(def, row, 1);
+            }
+
+            return (((ub1 *) (def->buf.data)) + (size_t) (def->col.bufsize * row));
         }
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DefineExpandStrings
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_DefineExpandStrings
+(
+    OCI_Define *def,
+    ub4         offset,
+    ub4         count
+)
+{
+    const ub4 max_chars = (ub4) (def->col.bufsize / sizeof(otext)) - 1;
+
+    for (ub4 row = offset; row < offset + count; row++)
+    {
+        const ub1 mask = (ub1) (1 << (row & 7));
+
+        if (!(def->expanded[row >> 3] & mask))
+        {
+            ub1    *data = ((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * row);
+            dbtext *src  = (dbtext *) data;
+            ub4     len  = 0;
+
+            /* Oracle UTF16 string is converted in place, from its actual length only */
+
+            while ((len < max_chars) && src[len])
+            {
+                len++;
+            }
+
+            len = (ub4) OCI_StringUTF16ToUTF32Count((unsigned short *) data, (unsigned int *) data, (int) len);
+
+            ((otext *) data)[len] = 0;
+
+            /* surrogate pairs are combined, so the length is updated to the expanded string */
+
+            OCI_DefineSetLength(def, row, (ub4) (len * sizeof(dbtext)));
+
+            def->expanded[row >> 3] |= mask;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DefineGetLength
+ * --------------------------------------------------------------------------------------------- */
+
+ub4 OCI_DefineGetLength
+(
+    OCI_Define *def,
+    ub4         row
+)
+{
+    /* lengths are ub4 for DML returning resultsets and ub2 otherwise */
+
+    if (sizeof(ub4) == def->buf.sizelen)
+    {
+        return ((ub4 *) def->buf.lens)[row];
+    }
+
+    return ((ub2 *) def->buf.lens)[row];
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DefineSetLength
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_DefineSetLength
+(
+    OCI_Define *def,
+    ub4         row,
+    ub4         len
+)
+{
+    if (sizeof(ub4) == def->buf.sizelen)
+    {
+        ((ub4 *) def->buf.lens)[row] = len;
+    }
+    else
+    {
+        ((ub2 *) def->buf.lens)[row] = (ub2) len;
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_DefineIsDataNotNull
  * --------------------------------------------------------------------------------------------- */
@@ -207,6 +292,56 @@ boolean OCI_DefineGetNumber
     return res;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DefineIsPlainBuffer
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_DefineIsPlainBuffer
+(
+    OCI_Define *def
+)
+{
+    /* plain buffers hold the fetched values themselves and not OCI descriptors or handles */
+
+    return (OCI_UNKNOWN == def->col.handletype) && (OCI_CDT_LONG != def->col.datatype) &&
+           (SQLT_NTY != def->col.sqlcode) && (SQLT_REF != def->col.sqlcode);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DefineGetRowSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_DefineGetRowSize
+(
+    OCI_Define *def
+)
+{
+    unsigned int size = (unsigned int) (sizeof(OCIInd) + def->buf.sizelen);
+
+    if (OCI_CDT_LONG == def->col.datatype)
+    {
+        /* LONG pieces are allocated for each fetched row */
+
+        size += (unsigned int) sizeof(OCI_Long *) + def->rs->stmt->long_size;
+    }
+    else
+    {
+        size += def->col.bufsize;
+    }
+
+    if (!OCI_DefineIsPlainBuffer(def) && (OCI_CDT_LONG != def->col.datatype))
+    {
+        size += OCI_FETCH_HANDLE_SIZE;
+    }
+
+    if (SQLT_NTY == def->col.sqlcode)
+    {
+        size += (unsigned int) sizeof(void *);
+    }
+
+    return size;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_DefineAlloc
  * --------------------------------------------------------------------------------------------- */
@@ -233,6 +368,13 @@ boolean OCI_DefineAlloc
         OCI_ALLOCATE_DATA(OCI_IPC_INDICATOR_ARRAY, def->buf.obj_inds, def->buf.count);
     }
 
+    /* Allocate bitmap of strings already expanded for Unicode builds that need buffer expansion */
+
+    if ((OCI_CDT_TEXT == def->col.datatype) && OCILib.use_wide_char_conv)
+    {
+        OCI_ALLOCATE_DATA(OCI_IPC_BUFF_ARRAY, def->expanded, (def->buf.count + 7) / 8);
+    }
+
     /* Allocate row data sizes array */
 
     OCI_ALLOCATE_BUFFER(OCI_IPC_LEN_ARRAY, def->buf.lens, def->buf.sizelen, def->buf.count)
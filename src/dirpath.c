@@ -763,8 +763,10 @@ boolean OCI_API OCI_DirPathSetEntry
 
             if (OCI_DDT_TEXT == dpcol->type && OCILib.use_wide_char_conv)
             {
-                size = ocharcount(size);
-                OCI_StringUTF32ToUTF16(value, data, size);
+                /* the column buffer holds up to 2 code units per character, enough for the
+                   surrogate pairs of supplementary characters */
+
+                size = (unsigned int) OCI_StringUTF32ToUTF16(value, data, ocharcount(size));
             }
             else if (OCI_DDT_OTHERS == dpcol->type && OCI_CHAR_WIDE == OCILib.charset)
             {
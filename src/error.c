@@ -20,6 +20,20 @@
 
 #include "ocilib_internal.h"
 
+#ifdef OCI_THREAD_LOCAL
+
+/* per thread error object cached in compiler thread local storage.
+   Ownership stays with the OCILIB error thread key that frees it at thread exit */
+
+static OCI_THREAD_LOCAL OCI_Error     *ErrorCache    = NULL;
+static OCI_THREAD_LOCAL OCI_ThreadKey *ErrorCacheKey = NULL;
+
+/* mirror of the raise flag of the current thread error object, readable without any lookup */
+
+static OCI_THREAD_LOCAL boolean        ErrorPending  = FALSE;
+
+#endif
+
 /* ********************************************************************************************* *
  *                             PRIVATE FUNCTIONS
  * ********************************************************************************************* */
@@ -50,6 +64,19 @@ void OCI_ErrorFree
         return;
     }
 
+#ifdef OCI_THREAD_LOCAL
+
+    /* called from the thread owning the error object at thread exit or at cleanup */
+
+    if (err && err == ErrorCache)
+    {
+        ErrorCache    = NULL;
+        ErrorCacheKey = NULL;
+        ErrorPending  = FALSE;
+    }
+
+#endif
+
     if (err)
     {
         free(err);
@@ -74,10 +101,60 @@ void OCI_ErrorReset
         err->sqlcode    = 0;
         err->libcode    = 0;
         err->type       = 0;
+        err->str_oracle = FALSE;
         err->str[0]     = 0;
+
+        OCI_ErrorUpdatePending(err);
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ErrorGetOracleMessage
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ErrorGetOracleMessage
+(
+    OCI_Error *err,
+    dvoid     *handle
+)
+{
+    /* the error code must be retrieved before the OCI error handle is reused but the message is
+       stored as returned by OCI and only converted when requested by OCI_ErrorGetString().
+       Oracle characters are never larger than native ones, so the raw message fits in place */
+
+    OCIErrorGet(handle, (ub4) 1, (OraText *) NULL, &err->sqlcode, (OraText *) err->str,
+                (ub4) ((OCI_ERR_MSG_SIZE + 1) * sizeof(dbtext)), (ub4) OCI_HTYPE_ERROR);
+
+    err->str_oracle = TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ErrorUpdatePending
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ErrorUpdatePending
+(
+    OCI_Error *err
+)
+{
+
+#ifdef OCI_THREAD_LOCAL
+
+    /* only the error object of the calling thread is mirrored */
+
+    if (err && (err == ErrorCache || err == &OCILib.lib_err))
+    {
+        ErrorPending = err->raise;
+    }
+
+#else
+
+    OCI_NOT_USED(err)
+
+#endif
+
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ErrorGet
  * --------------------------------------------------------------------------------------------- */
@@ -92,7 +169,18 @@ OCI_Error * OCI_ErrorGet
 
     if (OCILib.loaded && OCI_LIB_THREADED)
     {
-        if (OCI_ThreadKeyGet(OCILib.key_errs, (void **)(dvoid *)&err))
+    #ifdef OCI_THREAD_LOCAL
+
+        /* fast path: error object already registered in the current error thread key */
+
+        if (ErrorCacheKey == OCILib.key_errs)
+        {
+            err = ErrorCache;
+        }
+
+    #endif
+
+        if (!err && OCI_ThreadKeyGet(OCILib.key_errs, (void **)(dvoid *)&err))
         {
             if (!err)
             {
@@ -103,6 +191,14 @@ OCI_Error * OCI_ErrorGet
                     OCI_ThreadKeySet(OCILib.key_errs, err);
                 }
             }
+
+        #ifdef OCI_THREAD_LOCAL
+
+            ErrorCache    = err;
+            ErrorCacheKey = OCILib.key_errs;
+
+        #endif
+
         }
     }
     else
@@ -139,6 +235,24 @@ const otext * OCI_API OCI_ErrorGetString
 {
     OCI_CHECK(NULL == err, NULL);
 
+    /* convert the message retrieved from OCI on first access */
+
+    if (err->str_oracle)
+    {
+        const dbtext *dbstr = (const dbtext *) err->str;
+        int           len   = 0;
+
+        while (dbstr[len])
+        {
+            len++;
+        }
+
+        len = OCI_StringCopyOracleStringToNativeString(dbstr, err->str, len);
+
+        err->str[len]   = 0;
+        err->str_oracle = FALSE;
+    }
+
     return err->str;
 }
 
@@ -225,3 +339,25 @@ unsigned int OCI_API OCI_ErrorGetRow
 
     return err->row;
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetLastErrorFlag
+ * --------------------------------------------------------------------------------------------- */
+
+const boolean * OCI_API OCI_GetLastErrorFlag
+(
+    void
+)
+{
+
+#ifdef OCI_THREAD_LOCAL
+
+    return &ErrorPending;
+
+#else
+
+    return NULL;
+
+#endif
+
+}
@@ -92,7 +92,9 @@ static const otext * OCILib_TypeNames[OCI_IPC_COUNT] =
     OTEXT("Internal Long handle data buffer"),
     OTEXT("Internal trace info structure"),
     OTEXT("Internal array of direct path columns"),
-    OTEXT("Internal array of batch error objects")
+    OTEXT("Internal array of batch error objects"),
+    OTEXT("Internal array of statement handles"),
+    OTEXT("Internal column cache handle")
 };
 
 #if defined(OCI_CHARSET_WIDE) && !defined(_MSC_VER)
@@ -129,7 +131,8 @@ static const otext * OCILib_ErrorMsg[OCI_ERR_COUNT] =
     OTEXT("Argument '%ls' : Invalid value %d"),
     OTEXT("Cannot retrieve OCI environment from XA connection string '%ls'"),
     OTEXT("Cannot connect to database using XA connection string '%ls'"),
-    OTEXT("Binding '%ls': Passing non NULL host variable is not allowed when bind allocation mode is internal")
+    OTEXT("Binding '%ls': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
+    OTEXT("Cannot write to the output stream (system error %d)")
 };
 
 #else
@@ -166,7 +169,8 @@ static const otext * OCILib_ErrorMsg[OCI_ERR_COUNT] =
     OTEXT("Argument '%s' : Invalid value %d"),
     OTEXT("Cannot retrieve OCI environment from XA connection string '%s'"),
     OTEXT("Cannot connect to database using XA connection string '%s'"),
-    OTEXT("Binding '%s': Passing non NULL host variable is not allowed when bind allocation mode is internal")
+    OTEXT("Binding '%s': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
+    OTEXT("Cannot write to the output stream (system error %d)")
 };
 
 #endif
@@ -259,6 +263,18 @@ void OCI_ExceptionRaise
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ExceptionGetTypeName
+ * --------------------------------------------------------------------------------------------- */
+
+const otext * OCI_ExceptionGetTypeName
+(
+    int type
+)
+{
+    return OCILib_TypeNames[type+1];
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ExceptionOCI
  * --------------------------------------------------------------------------------------------- */
@@ -275,20 +291,16 @@ void OCI_ExceptionOCI
 
     if (err)
     {
-        int     dbsize = (int) (osizeof(err->str) - (size_t) 1);
-        dbtext *dbstr  =  OCI_StringGetOracleString(err->str, &dbsize);
-
         err->type = (warning ? OCI_ERR_WARNING : OCI_ERR_ORACLE);
         err->con  = con;
         err->stmt = stmt;
 
-        /* get oracle description */
-
-        OCIErrorGet((dvoid *) p_err, (ub4) 1, (OraText *) NULL, &err->sqlcode,
-                    (OraText *) dbstr, (ub4) dbsize, (ub4) OCI_HTYPE_ERROR);
+        /* get oracle description unless it is a warning that cannot be reported */
 
-        OCI_StringCopyOracleStringToNativeString(dbstr, err->str, dbcharcount(dbsize));
-        OCI_StringReleaseOracleString(dbstr);
+        if (!warning || OCILib.warnings_on || OCILib.error_handler)
+        {
+            OCI_ErrorGetOracleMessage(err, (dvoid *) p_err);
+        }
     }
 
     OCI_ExceptionRaise(err);
@@ -1148,4 +1160,36 @@ void OCI_ExceptionExternalBindingNotAllowed
 
     OCI_ExceptionRaise(err);
 
-}
\ No newline at end of file
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ExceptionStreamWrite
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ExceptionStreamWrite
+(
+    OCI_Statement *stmt,
+    int            code
+)
+{
+    OCI_Error *err = OCI_ExceptionGetError();
+
+    if (err)
+    {
+        err->type    = OCI_ERR_OCILIB;
+        err->libcode = OCI_ERR_STREAM_WRITE;
+        err->stmt    = stmt;
+
+        if (stmt)
+        {
+            err->con = stmt->con;
+        }
+
+        osprintf(err->str,
+                 osizeof(err->str) - (size_t) 1,
+                 OCILib_ErrorMsg[OCI_ERR_STREAM_WRITE],
+                 code);
+    }
+
+    OCI_ExceptionRaise(err);
+}
@@ -37,22 +37,158 @@ static const unsigned int HashTypeValues[] = { OCI_HASH_STRING, OCI_HASH_INTEGER
 
 unsigned int OCI_HashCompute
 (
-    OCI_HashTable *table,
-    const otext   *str
+    const otext *str
 )
 {
-    unsigned int h;
-    otext *p;
+    unsigned int h = OCI_HASH_FNV_BASIS;
 
-    OCI_CHECK(NULL == table, 0);
     OCI_CHECK(NULL == str, 0);
 
-    for(h = 0, p = (otext *) str; (*p) != 0; p++)
+    /* case insensitive FNV-1a hash */
+
+    for (const otext *p = str; (*p) != 0; p++)
     {
-        h = 31 * h + otoupper(*p);
+        h = (h ^ (unsigned int) otoupper(*p)) * OCI_HASH_FNV_PRIME;
     }
 
-    return (h % table->size);
+    /* the highest bit is set for distinguishing used slots from empty ones */
+
+    return h | OCI_HASH_USED_SLOT;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HashFind
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_HashEntry * OCI_HashFind
+(
+    OCI_HashTable *table,
+    const otext   *key
+)
+{
+    OCI_CHECK(NULL == table, NULL);
+    OCI_CHECK(NULL == key, NULL);
+
+    const unsigned int hash = OCI_HashCompute(key);
+    const unsigned int mask = table->size - 1;
+
+    /* linear probing: keys are compared only when their precomputed hash codes match */
+
+    for (unsigned int i = hash & mask; table->hashes[i]; i = (i + 1) & mask)
+    {
+        if (table->hashes[i] == hash && ostrcasecmp(table->items[i]->key, key) == 0)
+        {
+            return table->items[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HashResize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_HashResize
+(
+    OCI_HashTable *table,
+    unsigned int   size
+)
+{
+    OCI_HashEntry **items  = NULL;
+    unsigned int   *hashes = NULL;
+
+    items  = (OCI_HashEntry **) OCI_MemAlloc(OCI_IPC_HASHENTRY_ARRAY, sizeof(*items), (size_t) size, TRUE);
+    hashes = (unsigned int *) OCI_MemAlloc(OCI_IPC_HASHENTRY_ARRAY, sizeof(*hashes), (size_t) size, TRUE);
+
+    if (!items || !hashes)
+    {
+        OCI_FREE(items)
+        OCI_FREE(hashes)
+
+        return FALSE;
+    }
+
+    /* move existing entries using their stored hash codes */
+
+    for (unsigned int i = 0; i < table->size; i++)
+    {
+        if (table->hashes[i])
+        {
+            unsigned int j = table->hashes[i] & (size - 1);
+
+            while (hashes[j])
+            {
+                j = (j + 1) & (size - 1);
+            }
+
+            items[j]  = table->items[i];
+            hashes[j] = table->hashes[i];
+        }
+    }
+
+    OCI_FREE(table->items)
+    OCI_FREE(table->hashes)
+
+    table->items  = items;
+    table->hashes = hashes;
+    table->size   = size;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HashInsert
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_HashEntry * OCI_HashInsert
+(
+    OCI_HashTable *table,
+    const otext   *key
+)
+{
+    OCI_HashEntry *e = OCI_HashFind(table, key);
+
+    if (!e)
+    {
+        const size_t key_size = (ostrlen(key) + (size_t) 1) * sizeof(otext);
+
+        /* keep the load factor under 75%, a table of the maximum size cannot grow anymore */
+
+        if ((table->count + 1) * 4 > table->size * 3 &&
+            ((table->size >= OCI_HASH_MAX_SIZE) || !OCI_HashResize(table, table->size * 2)))
+        {
+            return NULL;
+        }
+
+        /* the key is stored in the same memory block than the entry */
+
+        e = (OCI_HashEntry *) OCI_MemAlloc(OCI_IPC_HASHENTRY, sizeof(*e) + key_size, (size_t) 1, TRUE);
+
+        if (e)
+        {
+            const unsigned int hash = OCI_HashCompute(key);
+            const unsigned int mask = table->size - 1;
+
+            unsigned int i = hash & mask;
+
+            e->key = (otext *) (e + 1);
+
+            memcpy(e->key, key, key_size);
+
+            while (table->hashes[i])
+            {
+                i = (i + 1) & mask;
+            }
+
+            table->items[i]  = e;
+            table->hashes[i] = hash;
+
+            table->count++;
+        }
+    }
+
+    return e;
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -75,7 +211,7 @@ boolean OCI_HashAdd
     OCI_CHECK(NULL == key, FALSE)
     OCI_CHECK(table->type != type, FALSE)
 
-    e = OCI_HashLookup(table, key, TRUE);
+    e = OCI_HashInsert(table, key);
 
     if (e)
     {
@@ -144,21 +280,24 @@ OCI_HashTable * OCI_API OCI_HashCreate
     table = (OCI_HashTable *) OCI_MemAlloc(OCI_IPC_HASHTABLE, sizeof(*table), (size_t) 1, TRUE);
     OCI_STATUS = (NULL != table);
 
-    /* set up attributes and allocate internal array of hash entry pointers */
+    /* set up attributes and allocate internal arrays of slots */
 
     if (OCI_STATUS)
     {
+        unsigned int capacity = OCI_HASH_MIN_SIZE;
+
+        /* the capacity is bounded to keep it a power of 2 that does not overflow */
+
+        while ((capacity < size) && (capacity < OCI_HASH_MAX_SIZE))
+        {
+            capacity *= 2;
+        }
+
         table->type  = type;
         table->size  = 0;
         table->count = 0;
 
-        table->items = (OCI_HashEntry **) OCI_MemAlloc(OCI_IPC_HASHENTRY_ARRAY, sizeof(*table->items), (size_t) size, TRUE);
-        OCI_STATUS = (NULL != table->items);
-        
-        if (OCI_STATUS)
-        {
-            table->size = size;           
-        }
+        OCI_STATUS = OCI_HashResize(table, capacity);
     }
 
     if (OCI_STATUS)
@@ -182,9 +321,6 @@ boolean OCI_API OCI_HashFree
     OCI_HashTable *table
 )
 {
-    OCI_HashEntry *e1 = NULL, *e2 = NULL;
-    OCI_HashValue *v1 = NULL, *v2 = NULL;
-
     OCI_CALL_ENTER(boolean, FALSE)
     OCI_CALL_CHECK_PTR(OCI_IPC_HASHTABLE, table)
 
@@ -192,18 +328,16 @@ boolean OCI_API OCI_HashFree
     {
         for (unsigned int i = 0; i < table->size; i++)
         {
-            e1 = table->items[i];
+            OCI_HashEntry *e = table->items[i];
 
-            while (e1)
+            if (e)
             {
-                e2 = e1;
-                e1 = e1->next;
-
-                v1 = e2->values;
+                OCI_HashValue *v1 = e->values;
 
                 while (v1)
                 {
-                    v2 = v1;
+                    OCI_HashValue *v2 = v1;
+
                     v1 = v1->next;
 
                     if (OCI_HASH_STRING == table->type)
@@ -214,21 +348,17 @@ boolean OCI_API OCI_HashFree
                     OCI_FREE(v2)
                 }
 
-                if (e2->key)
-                {
-                    OCI_FREE(e2->key)
-                }
+                /* the key is part of the entry memory block */
 
-                if (e2)
-                {
-                    OCI_FREE(e2)
-                }
+                OCI_FREE(e)
             }
         }
 
         OCI_FREE(table->items)
     }
 
+    OCI_FREE(table->hashes)
+
     OCI_RETVAL = TRUE;
 
     OCI_FREE(table)
@@ -284,7 +414,7 @@ OCI_HashValue * OCI_API OCI_HashGetValue
     OCI_CALL_ENTER(OCI_HashValue*, NULL)
     OCI_CALL_CHECK_PTR(OCI_IPC_HASHTABLE, table)
 
-    e = OCI_HashLookup(table, key, FALSE);
+    e = OCI_HashFind(table, key);
 
     if (e)
     {
@@ -476,61 +606,16 @@ OCI_HashEntry * OCI_API OCI_HashLookup
     boolean        create
 )
 {
-    OCI_HashEntry *e = NULL, *e1 = NULL, *e2 = NULL;
+    OCI_HashEntry *e = NULL;
 
     OCI_CALL_ENTER(OCI_HashEntry*, NULL)
     OCI_CALL_CHECK_PTR(OCI_IPC_HASHTABLE, table)
     OCI_CALL_CHECK_PTR(OCI_IPC_STRING, key)
 
-    const unsigned int i = OCI_HashCompute(table, key);
-
-    if (i < table->size)
-    {
-        for(e = table->items[i]; e; e = e->next)
-        {
-            if (ostrcasecmp(e->key, key) == 0)
-            {
-                break;
-            }
-        }
-
-        if (!e && create)
-        {
-            e = (OCI_HashEntry *) OCI_MemAlloc(OCI_IPC_HASHENTRY, sizeof(*e), (size_t) 1, TRUE);
-            OCI_STATUS = (NULL != e);
-           
-            if (OCI_STATUS)
-            {
-                e->key = ostrdup(key);
-
-                e1 = e2 = table->items[i];
-
-                while (e1)
-                {
-                    e2 = e1;
-                    e1 = e1->next;
-                }
+    e = create ? OCI_HashInsert(table, key) : OCI_HashFind(table, key);
+    OCI_STATUS = (NULL != e) || !create;
 
-                if (e2)
-                {
-                    e2->next = e;
-                }
-                else
-                {
-                    table->items[i] = e;
-                }
-            }
-        }
-    }
-
-    if (OCI_STATUS)
-    {
-        OCI_RETVAL = e;
-    }
-    else if (e)
-    {
-        OCI_FREE(e)
-    }
+    OCI_RETVAL = e;
 
     OCI_CALL_EXIT()
 }
@@ -394,12 +394,12 @@ boolean OCI_API OCI_IntervalToText
 
     dbsize = (int)len;
 
-    OCI_StringCopyOracleStringToNativeString(dbstr, str, dbcharcount(dbsize));
+    len = (size_t) OCI_StringCopyOracleStringToNativeString(dbstr, str, dbcharcount(dbsize));
     OCI_StringReleaseOracleString(dbstr);
 
     /* set null string terminator */
 
-    str[dbcharcount(dbsize)] = 0;
+    str[len] = 0;
 
 
     OCI_RETVAL = OCI_STATUS;
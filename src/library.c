@@ -810,6 +810,8 @@ void OCI_CallExit
         ctx->call_err->raise = (ctx->call_err->depth == 0) &&
                                (ctx->call_err->type != OCI_UNKNOWN) &&
                                (!ctx->call_status || (OCI_ERR_WARNING == ctx->call_err->type && OCILib.warnings_on));
+
+        OCI_ErrorUpdatePending(ctx->call_err);
     } 
 }
 
@@ -1626,8 +1628,12 @@ boolean OCI_API OCI_Initialize
 
             OCI_STATUS = OCI_SUCCESSFUL(OCIThreadInit(OCILib.env, OCILib.err));
 
+        #ifndef OCI_ATOMIC_ENABLED
+
             OCILib.mem_mutex = OCI_MutexCreateInternal();
             OCI_STATUS = (NULL != OCILib.mem_mutex);
+
+        #endif
         }
 
         /* create thread key for thread errors */
@@ -1638,6 +1644,18 @@ boolean OCI_API OCI_Initialize
             OCI_STATUS = (NULL != OCILib.key_errs);
         }
 
+    #ifdef OCI_MEM_POOL_ENABLED
+
+        /* create thread key for releasing thread memory caches */
+
+        if (OCI_STATUS)
+        {
+            OCILib.key_mem = OCI_ThreadKeyCreateInternal((POCI_THREADKEYDEST) OCI_MemPoolCacheFree);
+            OCI_STATUS = (NULL != OCILib.key_mem);
+        }
+
+    #endif
+
         /* allocate connections internal list */
 
         if (OCI_STATUS)
@@ -1776,6 +1794,18 @@ boolean OCI_API OCI_Cleanup
         OCI_ThreadKeyFree(key);
     }
 
+    /* free memory cache thread key */
+
+    if (OCILib.key_mem)
+    {
+        OCI_ThreadKey *key = OCILib.key_mem;
+
+        OCILib.key_mem = NULL;
+
+        OCI_ThreadKeySet(key, NULL);
+        OCI_ThreadKeyFree(key);
+    }
+
     /* set unloaded flag */
 
     OCILib.loaded = FALSE;
@@ -1830,6 +1860,14 @@ boolean OCI_API OCI_Cleanup
         res = FALSE;
     }
 
+#ifdef OCI_MEM_POOL_ENABLED
+
+    /* release pooled memory blocks */
+
+    OCI_MemPoolCleanup();
+
+#endif
+
     memset(&OCILib, 0, sizeof(OCILib));
 
     return res;
@@ -1897,12 +1935,12 @@ big_uint OCI_API OCI_GetAllocatedBytes
 
     if (mem_type & OCI_MEM_ORACLE)
     {
-        call_retval += OCILib.mem_bytes_oci;
+        call_retval += OCI_MemGetBytes(OCI_IPC_ORACLE);
     }
 
     if (mem_type & OCI_MEM_OCILIB)
     {
-        call_retval += OCILib.mem_bytes_lib;
+        call_retval += OCI_MemGetBytes(OCI_IPC_VOID);
     }
 
     OCI_CALL_EXIT()
@@ -413,7 +413,9 @@ boolean OCI_API OCI_LobRead2
 
             if (!OCILib.nls_utf8 && OCILib.use_wide_char_conv)
             {
-                OCI_StringUTF16ToUTF32(buffer, buffer, (int) (*char_count));
+                /* surrogate pairs are combined, so fewer characters may be returned */
+
+                (*char_count) = (ub4) OCI_StringUTF16ToUTF32(buffer, buffer, (int) (*char_count));
                 (*byte_count) = (ub4) (*char_count) * (ub4) sizeof(otext);
             }
         }
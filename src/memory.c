@@ -38,6 +38,87 @@
        OCI_MutexRelease(OCILib.mem_mutex);  \
     }                                       \
 
+#ifdef OCI_ATOMIC_ENABLED
+
+    #define OCI_COUNTER_ADD(counter, value)     OCI_ATOMIC_ADD(&(counter), (value));
+    #define OCI_COUNTER_ADD_BIG(counter, value) OCI_ATOMIC_ADD_BIG(&(counter), (value));
+
+#else
+
+    #define OCI_COUNTER_ADD(counter, value)     OCI_MUTEXED_CALL((counter) += (value))
+    #define OCI_COUNTER_ADD_BIG(counter, value) OCI_MUTEXED_CALL((counter) += (value))
+
+#endif
+
+#ifdef OCI_MEM_POOL_ENABLED
+
+#define OCI_POOL_LOCK(pool)     OCI_SPIN_LOCK(&(pool)->lock)
+#define OCI_POOL_UNLOCK(pool)   OCI_SPIN_UNLOCK(&(pool)->lock)
+
+/* free blocks are chained through their first data bytes */
+
+#define OCI_POOL_NEXT(block)    (*(void **) (((OCI_MemoryBlock *) (block)) + 1))
+
+/* caches of all threads are listed for being released at cleanup. Caches of threads still
+   alive are then detected through the generation number incremented by each cleanup */
+
+static OCI_MemoryCache *MemCaches          = NULL;
+static volatile long    MemCachesLock       = 0;
+static volatile long    MemCachesGeneration = 0;
+
+static OCI_THREAD_LOCAL OCI_MemoryCache *MemCache           = NULL;
+static OCI_THREAD_LOCAL long             MemCacheGeneration = 0;
+static OCI_THREAD_LOCAL boolean          MemCacheReleased   = FALSE;
+
+#endif
+
+#ifdef OCI_THREAD_LOCAL
+
+/* threads are given a counter in a round robin way at their first allocation */
+
+static volatile long MemCountersNext = 0;
+
+static OCI_THREAD_LOCAL long MemCounterIndex = -1;
+
+#endif
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemGetCounter
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_MemoryCounter * OCI_MemGetCounter
+(
+    void
+)
+{
+#ifdef OCI_THREAD_LOCAL
+
+    if (MemCounterIndex < 0)
+    {
+
+    #ifdef OCI_ATOMIC_ENABLED
+
+        MemCounterIndex = OCI_ATOMIC_ADD(&MemCountersNext, 1) & (OCI_MEM_COUNTERS_COUNT - 1);
+
+    #else
+
+        MemCounterIndex = MemCountersNext++ & (OCI_MEM_COUNTERS_COUNT - 1);
+
+    #endif
+
+    }
+
+    return &OCILib.mem_bytes[MemCounterIndex];
+
+#else
+
+    /* without thread local storage, all threads share the same counter */
+
+    return &OCILib.mem_bytes[0];
+
+#endif
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_MemAlloc
  * --------------------------------------------------------------------------------------------- */
@@ -53,7 +134,22 @@ void * OCI_MemAlloc
     OCI_MemoryBlock * mem_block = NULL;
     const size_t size = sizeof(OCI_MemoryBlock) + (block_size * block_count);
 
-    mem_block = (OCI_MemoryBlock *)malloc(size);
+#ifdef OCI_MEM_POOL_ENABLED
+
+    const int pool_index = OCI_MemPoolGetIndex(ptr_type, size);
+
+    if (pool_index >= 0)
+    {
+        mem_block = (OCI_MemoryBlock *) OCI_MemPoolAlloc(pool_index);
+    }
+
+    if (!mem_block)
+
+#endif
+
+    {
+        mem_block = (OCI_MemoryBlock *)malloc(size);
+    }
 
     if (mem_block)
     {
@@ -149,6 +245,17 @@ void OCI_MemFree
         {
             OCI_MemUpdateBytes(mem_block->type, (big_int) 0 - mem_block->size);
 
+        #ifdef OCI_MEM_POOL_ENABLED
+
+            const int pool_index = OCI_MemPoolGetIndex(mem_block->type, mem_block->size);
+
+            if (pool_index >= 0 && OCI_MemPoolFree(pool_index, mem_block))
+            {
+                return;
+            }
+
+        #endif
+
             free(mem_block);
         }
     }
@@ -164,16 +271,488 @@ void OCI_MemUpdateBytes
     big_int size
 )
 {
+    OCI_MemoryCounter *counter = OCI_MemGetCounter();
+
     if (OCI_IPC_ORACLE == type)
     {
-        OCI_MUTEXED_CALL(OCILib.mem_bytes_oci += size)
+        OCI_COUNTER_ADD_BIG(counter->oci, size)
+    }
+    else
+    {
+        OCI_COUNTER_ADD_BIG(counter->lib, size)
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* OCI_MemGetBytes
+* --------------------------------------------------------------------------------------------- */
+
+big_uint OCI_MemGetBytes
+(
+    int type
+)
+{
+    big_int total = 0;
+
+    for (int i = 0; i < OCI_MEM_COUNTERS_COUNT; i++)
+    {
+        OCI_MemoryCounter *counter = &OCILib.mem_bytes[i];
+
+        /* a given counter may be negative as memory can be freed by another thread than the allocating one */
+
+    #ifdef OCI_ATOMIC_ENABLED
+
+        total += OCI_ATOMIC_ADD_BIG(OCI_IPC_ORACLE == type ? &counter->oci : &counter->lib, 0);
+
+    #else
+
+        total += OCI_IPC_ORACLE == type ? counter->oci : counter->lib;
+
+    #endif
+
+    }
+
+    return total > 0 ? (big_uint) total : 0;
+}
+
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolGetIndex
+ * --------------------------------------------------------------------------------------------- */
+
+int OCI_MemPoolGetIndex
+(
+    int    type,
+    size_t size
+)
+{
+    int    index      = -1;
+    size_t block_size = 0;
+
+    switch (type)
+    {
+        case OCI_IPC_LIST_ITEM:  index = 0;  block_size = sizeof(OCI_Item);      break;
+        case OCI_IPC_HASHVALUE:  index = 1;  block_size = sizeof(OCI_HashValue); break;
+        case OCI_IPC_DATE:       index = 2;  block_size = sizeof(OCI_Date);      break;
+        case OCI_IPC_OCIDATE:    index = 3;  block_size = sizeof(OCIDate);       break;
+        case OCI_IPC_TIMESTAMP:  index = 4;  block_size = sizeof(OCI_Timestamp); break;
+        case OCI_IPC_INTERVAL:   index = 5;  block_size = sizeof(OCI_Interval);  break;
+        case OCI_IPC_NUMBER:     index = 6;  block_size = sizeof(OCI_Number);    break;
+        case OCI_IPC_LOB:        index = 7;  block_size = sizeof(OCI_Lob);       break;
+        case OCI_IPC_FILE:       index = 8;  block_size = sizeof(OCI_File);      break;
+        case OCI_IPC_LONG:       index = 9;  block_size = sizeof(OCI_Long);      break;
+        case OCI_IPC_REF:        index = 10; block_size = sizeof(OCI_Ref);       break;
+        case OCI_IPC_ELEMENT:    index = 11; block_size = sizeof(OCI_Elem);      break;
+    }
+
+    /* arrays of these structures are not pooled. A null size only looks up the type */
+
+    if (size && size != sizeof(OCI_MemoryBlock) + block_size)
+    {
+        index = -1;
+    }
+
+    return index;
+}
+
+#ifdef OCI_MEM_POOL_ENABLED
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolGetCache
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_MemoryCache * OCI_MemPoolGetCache
+(
+    void
+)
+{
+    /* the cache of the thread has been released by a cleanup */
+
+    if (MemCache && MemCacheGeneration != MemCachesGeneration)
+    {
+        MemCache = NULL;
+    }
+
+    if (!MemCache && !MemCacheReleased)
+    {
+        MemCache = (OCI_MemoryCache *) calloc(1, sizeof(*MemCache));
+
+        if (MemCache)
+        {
+            MemCacheGeneration = MemCachesGeneration;
+
+            OCI_SPIN_LOCK(&MemCachesLock)
+
+            MemCache->next       = MemCaches;
+            MemCache->registered = TRUE;
+
+            if (MemCaches)
+            {
+                MemCaches->prev = MemCache;
+            }
+
+            MemCaches = MemCache;
+
+            OCI_SPIN_UNLOCK(&MemCachesLock)
+        }
+    }
+
+    /* register the cache in order to release it at thread exit */
+
+    if (MemCache && OCILib.key_mem && MemCache->key != OCILib.key_mem)
+    {
+        MemCache->key = OCILib.key_mem;
+
+        OCI_ThreadKeySet(OCILib.key_mem, MemCache);
+    }
+
+    return MemCache;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolPublish
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_MemPoolPublish
+(
+    OCI_MemoryPool      *pool,
+    OCI_MemoryPoolCache *cache
+)
+{
+    OCI_ATOMIC_ADD_BIG(&pool->allocs, (big_int) cache->allocs);
+    OCI_ATOMIC_ADD_BIG(&pool->hits,   (big_int) cache->hits);
+    OCI_ATOMIC_ADD_BIG(&pool->frees,  (big_int) cache->frees);
+
+    cache->allocs = 0;
+    cache->hits   = 0;
+    cache->frees  = 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolRelease
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_MemPoolRelease
+(
+    OCI_MemoryPool *pool,
+    void           *head,
+    void           *tail,
+    unsigned int    count
+)
+{
+    boolean kept = FALSE;
+
+    OCI_POOL_LOCK(pool)
+
+    if (pool->count + count <= OCI_MEM_POOL_MAX_FREE)
+    {
+        OCI_POOL_NEXT(tail) = pool->head;
+
+        pool->head   = head;
+        pool->count += count;
+
+        kept = TRUE;
+    }
+
+    OCI_POOL_UNLOCK(pool)
+
+    /* the shared pool is full, give the blocks back to the heap */
+
+    while (!kept && count-- > 0)
+    {
+        void *block = head;
+
+        head = OCI_POOL_NEXT(block);
+
+        free(block);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolAlloc
+ * --------------------------------------------------------------------------------------------- */
+
+void * OCI_MemPoolAlloc
+(
+    int index
+)
+{
+    OCI_MemoryPool  *pool  = &OCILib.mem_pools[index];
+    OCI_MemoryCache *cache = OCI_MemPoolGetCache();
+    void            *block = NULL;
+
+    if (cache)
+    {
+        OCI_MemoryPoolCache *pool_cache = &cache->pools[index];
+
+        if (!pool_cache->head && pool->head)
+        {
+            /* refill the thread cache with a batch of blocks from the shared pool.
+               The shared list head is checked again once the lock is acquired */
+
+            OCI_POOL_LOCK(pool)
+
+            while (pool->head && pool_cache->count < OCI_MEM_POOL_CACHE_SIZE / 2)
+            {
+                block = pool->head;
+
+                pool->head = OCI_POOL_NEXT(block);
+                pool->count--;
+
+                OCI_POOL_NEXT(block) = pool_cache->head;
+
+                pool_cache->head = block;
+                pool_cache->count++;
+            }
+
+            OCI_POOL_UNLOCK(pool)
+        }
+
+        block = pool_cache->head;
+
+        if (block)
+        {
+            pool_cache->head = OCI_POOL_NEXT(block);
+            pool_cache->count--;
+            pool_cache->hits++;
+        }
+
+        if (++pool_cache->allocs + pool_cache->frees >= OCI_MEM_POOL_STATS_PERIOD)
+        {
+            OCI_MemPoolPublish(pool, pool_cache);
+        }
+    }
+    else
+    {
+        OCI_POOL_LOCK(pool)
+
+        block = pool->head;
+
+        if (block)
+        {
+            pool->head = OCI_POOL_NEXT(block);
+            pool->count--;
+        }
+
+        OCI_POOL_UNLOCK(pool)
+
+        OCI_ATOMIC_ADD_BIG(&pool->allocs, 1);
+        OCI_ATOMIC_ADD_BIG(&pool->hits, block ? 1 : 0);
+    }
+
+    return block;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_MemPoolFree
+(
+    int   index,
+    void *block
+)
+{
+    OCI_MemoryPool  *pool  = &OCILib.mem_pools[index];
+    OCI_MemoryCache *cache = OCI_MemPoolGetCache();
+
+    if (cache)
+    {
+        OCI_MemoryPoolCache *pool_cache = &cache->pools[index];
+
+        OCI_POOL_NEXT(block) = pool_cache->head;
+
+        pool_cache->head = block;
+        pool_cache->count++;
+
+        if (pool_cache->count > OCI_MEM_POOL_CACHE_SIZE)
+        {
+            /* move half of the thread cache to the shared pool */
+
+            void *head  = pool_cache->head;
+            void *tail  = head;
+            unsigned int count = 1;
+
+            while (count < OCI_MEM_POOL_CACHE_SIZE / 2)
+            {
+                tail = OCI_POOL_NEXT(tail);
+                count++;
+            }
+
+            pool_cache->head   = OCI_POOL_NEXT(tail);
+            pool_cache->count -= count;
+
+            OCI_MemPoolRelease(pool, head, tail, count);
+        }
+
+        if (pool_cache->allocs + ++pool_cache->frees >= OCI_MEM_POOL_STATS_PERIOD)
+        {
+            OCI_MemPoolPublish(pool, pool_cache);
+        }
     }
     else
     {
-        OCI_MUTEXED_CALL(OCILib.mem_bytes_lib += size)
+        OCI_POOL_NEXT(block) = NULL;
+
+        OCI_MemPoolRelease(pool, block, block, 1);
+
+        OCI_ATOMIC_ADD_BIG(&pool->frees, 1);
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolCacheFlush
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_MemPoolCacheFlush
+(
+    OCI_MemoryCache *cache
+)
+{
+    for (int i = 0; i < OCI_MEM_POOL_COUNT; i++)
+    {
+        OCI_MemoryPool      *pool       = &OCILib.mem_pools[i];
+        OCI_MemoryPoolCache *pool_cache = &cache->pools[i];
+
+        if (pool_cache->head)
+        {
+            void *tail = pool_cache->head;
+
+            while (OCI_POOL_NEXT(tail))
+            {
+                tail = OCI_POOL_NEXT(tail);
+            }
+
+            OCI_MemPoolRelease(pool, pool_cache->head, tail, pool_cache->count);
+        }
+
+        OCI_MemPoolPublish(pool, pool_cache);
+
+        pool_cache->head  = NULL;
+        pool_cache->count = 0;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolCacheFree
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_MemPoolCacheFree
+(
+    OCI_MemoryCache *cache
+)
+{
+    boolean owned = FALSE;
+
+    if (cache)
+    {
+        /* a cache already taken by a cleanup is released by it */
+
+        OCI_SPIN_LOCK(&MemCachesLock)
+
+        if (cache->registered)
+        {
+            if (cache->prev)
+            {
+                cache->prev->next = cache->next;
+            }
+            else
+            {
+                MemCaches = cache->next;
+            }
+
+            if (cache->next)
+            {
+                cache->next->prev = cache->prev;
+            }
+
+            cache->registered = FALSE;
+
+            owned = TRUE;
+        }
+
+        OCI_SPIN_UNLOCK(&MemCachesLock)
+    }
+
+    if (owned)
+    {
+        OCI_MemPoolCacheFlush(cache);
+
+        free(cache);
+    }
+
+    /* called at thread exit: later deallocations of the thread go to the shared pools */
+
+    MemCache         = NULL;
+    MemCacheReleased = TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemPoolCleanup
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_MemPoolCleanup
+(
+    void
+)
+{
+    OCI_MemoryCache *cache = NULL;
+
+    /* take the caches of all threads, including the ones still alive */
+
+    OCI_SPIN_LOCK(&MemCachesLock)
+
+    cache     = MemCaches;
+    MemCaches = NULL;
+
+    for (OCI_MemoryCache *item = cache; item; item = item->next)
+    {
+        item->registered = FALSE;
+    }
+
+    MemCachesGeneration++;
+
+    OCI_SPIN_UNLOCK(&MemCachesLock)
+
+    /* cached blocks go to the shared pools that are drained below */
+
+    while (cache)
+    {
+        OCI_MemoryCache *next = cache->next;
+
+        OCI_MemPoolCacheFlush(cache);
+
+        free(cache);
+
+        cache = next;
+    }
+
+    MemCache = NULL;
+
+    for (int i = 0; i < OCI_MEM_POOL_COUNT; i++)
+    {
+        OCI_MemoryPool *pool = &OCILib.mem_pools[i];
+
+        OCI_POOL_LOCK(pool)
+
+        while (pool->head)
+        {
+            void *block = pool->head;
+
+            pool->head = OCI_POOL_NEXT(block);
+
+            free(block);
+        }
+
+        pool->count = 0;
+
+        OCI_POOL_UNLOCK(pool)
     }
 }
 
+#endif
 
 /* --------------------------------------------------------------------------------------------- *
  * OCI_HandleAlloc
@@ -190,7 +769,7 @@ boolean OCI_HandleAlloc
 
     if (OCI_SUCCESSFUL(ret))
     {
-        OCI_MUTEXED_CALL(OCILib.nb_hndlp++)
+        OCI_COUNTER_ADD(OCILib.nb_hndlp, 1)
     }
 
     return OCI_SUCCESSFUL(ret);
@@ -210,7 +789,7 @@ boolean OCI_HandleFree
 
     if (hndlp)
     {
-        OCI_MUTEXED_CALL(OCILib.nb_hndlp--)
+        OCI_COUNTER_ADD(OCILib.nb_hndlp, -1)
 
         ret = OCIHandleFree(hndlp, type);
     }
@@ -233,7 +812,7 @@ boolean OCI_DescriptorAlloc
 
     if (OCI_SUCCESSFUL(ret))
     {
-        OCI_MUTEXED_CALL(OCILib.nb_descp++)
+        OCI_COUNTER_ADD(OCILib.nb_descp, 1)
     }
 
     return OCI_SUCCESSFUL(ret);
@@ -273,7 +852,7 @@ boolean OCI_DescriptorArrayAlloc
 
     if (OCI_SUCCESSFUL(ret))
     {
-        OCI_MUTEXED_CALL(OCILib.nb_descp += nb_elem)
+        OCI_COUNTER_ADD(OCILib.nb_descp, nb_elem)
     }
 
     return OCI_SUCCESSFUL(ret);
@@ -293,7 +872,7 @@ boolean OCI_DescriptorFree
 
     if (descp)
     {
-        OCI_MUTEXED_CALL(OCILib.nb_descp--)
+        OCI_COUNTER_ADD(OCILib.nb_descp, -1)
 
         ret = OCIDescriptorFree(descp, type);
     }
@@ -335,7 +914,7 @@ boolean OCI_DescriptorArrayFree
             }
         }
 
-        OCI_MUTEXED_CALL(OCILib.nb_descp -= nb_elem)
+        OCI_COUNTER_ADD(OCILib.nb_descp, 0 - nb_elem)
     }
 
     return OCI_SUCCESSFUL(ret);
@@ -362,7 +941,7 @@ sword OCI_ObjectNew
 
     if (OCI_SUCCESSFUL(ret))
     {
-        OCI_MUTEXED_CALL(OCILib.nb_objinst++)
+        OCI_COUNTER_ADD(OCILib.nb_objinst, 1)
     }
 
     return ret;
@@ -384,7 +963,7 @@ sword OCI_OCIObjectFree
 
     if (instance)
     {
-        OCI_MUTEXED_CALL(OCILib.nb_objinst--)
+        OCI_COUNTER_ADD(OCILib.nb_objinst, -1)
 
         ret = OCIObjectFree(env, err, instance, flags);
     }
@@ -437,3 +1016,105 @@ void OCI_MemFreeOracleClient
 
     OCI_MemFree(memptr);
 }
+
+/* ********************************************************************************************* *
+ *                            PUBLIC FUNCTIONS
+ * ********************************************************************************************* */
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetMemoryPoolCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetMemoryPoolCount
+(
+    void
+)
+{
+    OCI_CALL_ENTER(unsigned int, 0)
+    OCI_CALL_CHECK_INITIALIZED()
+
+#ifdef OCI_MEM_POOL_ENABLED
+
+    OCI_RETVAL = OCI_MEM_POOL_COUNT;
+
+#endif
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetMemoryPoolStats
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetMemoryPoolStats
+(
+    unsigned int   index,
+    const otext  **name,
+    big_uint      *allocs,
+    big_uint      *hits,
+    big_uint      *frees
+)
+{
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_INITIALIZED()
+
+#ifdef OCI_MEM_POOL_ENABLED
+
+    OCI_CALL_CHECK_BOUND(NULL, index, 1, OCI_MEM_POOL_COUNT)
+
+    {
+        OCI_MemoryPool  *pool  = &OCILib.mem_pools[index - 1];
+        OCI_MemoryCache *cache = MemCache;
+
+        big_int nb_allocs = OCI_ATOMIC_ADD_BIG(&pool->allocs, 0);
+        big_int nb_hits   = OCI_ATOMIC_ADD_BIG(&pool->hits,   0);
+        big_int nb_frees  = OCI_ATOMIC_ADD_BIG(&pool->frees,  0);
+
+        /* add statistics of the calling thread not yet published */
+
+        if (cache)
+        {
+            nb_allocs += cache->pools[index - 1].allocs;
+            nb_hits   += cache->pools[index - 1].hits;
+            nb_frees  += cache->pools[index - 1].frees;
+        }
+
+        if (name)
+        {
+            *name = NULL;
+
+            for (int type = OCI_IPC_ORACLE; type < OCI_IPC_COUNT - 1; type++)
+            {
+                if (OCI_MemPoolGetIndex(type, 0) == (int) index - 1)
+                {
+                    *name = OCI_ExceptionGetTypeName(type);
+                }
+            }
+        }
+
+        if (allocs)
+        {
+            *allocs = (big_uint) nb_allocs;
+        }
+
+        if (hits)
+        {
+            *hits = (big_uint) nb_hits;
+        }
+
+        if (frees)
+        {
+            *frees = (big_uint) nb_frees;
+        }
+
+        OCI_RETVAL = TRUE;
+    }
+
+#else
+
+    OCI_CALL_CHECK_BOUND(NULL, index, 1, 0)
+
+#endif
+
+    OCI_CALL_EXIT()
+}
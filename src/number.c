@@ -38,6 +38,29 @@ static const MagicNumber MagicNumbers[] =
 
 #define OCI_MAGIC_NUMBER_COUNT 2
 
+static const double Pow10Values[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define OCI_NUMBER_EXP_ZERO             128
+#define OCI_NUMBER_EXP_POSITIVE         193
+#define OCI_NUMBER_EXP_NEGATIVE         62
+#define OCI_NUMBER_NEG_DIGIT_BASE       101
+#define OCI_NUMBER_NEG_TERMINATOR       102
+
+#define OCI_NUMBER_MAX_INTEGER          (~((big_uint) 0))
+#define OCI_NUMBER_DOUBLE_MAX_MANTISSA  ((big_uint) 1 << 53)
+#define OCI_NUMBER_FLOAT_MAX_MANTISSA   ((big_uint) 1 << 24)
+#define OCI_NUMBER_DOUBLE_MAX_POW10     22
+#define OCI_NUMBER_FLOAT_MAX_POW10      10
+#define OCI_NUMBER_DOUBLE_MAX_EXACT     1e15
+#define OCI_NUMBER_FLOAT_MAX_EXACT      1e6
+
+#define OCI_NUM_NATIVE_TYPES            (OCI_NUM_SHORT | OCI_NUM_INT | OCI_NUM_BIGINT | \
+                                         OCI_NUM_FLOAT | OCI_NUM_DOUBLE)
+
 
 #define OCI_NUMBER_OPERATION(func)                                                  \
                                                                                     \
@@ -94,6 +117,376 @@ uword OCI_GetNumericTypeSize
     return size;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberDecode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberDecode
+(
+    const OCINumber *number,
+    void            *value,
+    uword            type
+)
+{
+    /* Oracle NUMBER internal format:
+        - byte 0 : number of bytes used by the exponent and the mantissa
+        - byte 1 : sign bit and base 100 exponent (excess 65) complemented for negative numbers
+        - bytes 2 and more : base 100 digits stored as (digit + 1) for positive numbers and as
+          (101 - digit) for negative numbers that are also terminated by 102 if space allows
+
+       Only values that can be converted exactly are decoded here. For other ones (fractional
+       values to integers, overflows, infinities, inexact floating point computations), FALSE is
+       returned and the caller must rely on OCI conversions for getting results and errors
+    */
+
+    const ub1 *part = number->OCINumberPart;
+    const ub1  size = part[0];
+
+    boolean negative = FALSE;
+    big_uint mantissa = 0;
+    int exponent = 0;
+    int nb_digits = 0;
+
+    if (size < 1 || size >= OCI_NUMBER_SIZE || !value || !(type & OCI_NUM_NATIVE_TYPES))
+    {
+        return FALSE;
+    }
+
+    if (OCI_NUMBER_EXP_ZERO == part[1])
+    {
+        /* zero */
+
+        memset(value, 0, OCI_GetNumericTypeSize(type));
+
+        return (1 == size);
+    }
+
+    negative  = (part[1] < OCI_NUMBER_EXP_ZERO);
+    nb_digits = size - 1;
+
+    if (negative)
+    {
+        exponent = OCI_NUMBER_EXP_NEGATIVE - (int) part[1];
+
+        if (nb_digits > 0 && OCI_NUMBER_NEG_TERMINATOR == part[size])
+        {
+            nb_digits--;
+        }
+    }
+    else
+    {
+        exponent = (int) part[1] - OCI_NUMBER_EXP_POSITIVE;
+    }
+
+    /* infinity values */
+
+    if (nb_digits < 1)
+    {
+        return FALSE;
+    }
+
+    for (int i = 2; i < nb_digits + 2; i++)
+    {
+        const int digit = negative ? (OCI_NUMBER_NEG_DIGIT_BASE - part[i]) : (part[i] - 1);
+
+        if (digit < 0 || digit > 99 || mantissa > (OCI_NUMBER_MAX_INTEGER - (big_uint) digit) / 100)
+        {
+            return FALSE;
+        }
+
+        mantissa = mantissa * 100 + (big_uint) digit;
+    }
+
+    /* the value is mantissa * 100 ^ exponent once the exponent is made relative to the last digit */
+
+    exponent -= nb_digits - 1;
+
+    if (type & OCI_NUM_DOUBLE || type & OCI_NUM_FLOAT)
+    {
+        const boolean is_double = (type & OCI_NUM_DOUBLE) != 0;
+
+        /* exact when both mantissa and power of ten are exactly representable */
+
+        const big_uint max_mantissa = is_double ? OCI_NUMBER_DOUBLE_MAX_MANTISSA : OCI_NUMBER_FLOAT_MAX_MANTISSA;
+        const int      max_power    = is_double ? OCI_NUMBER_DOUBLE_MAX_POW10    : OCI_NUMBER_FLOAT_MAX_POW10;
+
+        const int power = exponent * 2;
+
+        if (mantissa > max_mantissa || power > max_power || power < -max_power)
+        {
+            return FALSE;
+        }
+
+        if (is_double)
+        {
+            double result = (double) mantissa;
+
+            result = power >= 0 ? result * Pow10Values[power] : result / Pow10Values[-power];
+
+            *((double *) value) = negative ? -result : result;
+        }
+        else
+        {
+            float result = (float) mantissa;
+
+            result = power >= 0 ? result * (float) Pow10Values[power] : result / (float) Pow10Values[-power];
+
+            *((float *) value) = negative ? -result : result;
+        }
+    }
+    else
+    {
+        const uword    out_size = OCI_GetNumericTypeSize(type);
+        const big_uint max_uint = (out_size >= sizeof(big_uint)) ? OCI_NUMBER_MAX_INTEGER : (((big_uint) 1) << (out_size * 8)) - 1;
+
+        big_uint max_value = max_uint;
+
+        /* fractional values */
+
+        if (exponent < 0)
+        {
+            return FALSE;
+        }
+
+        for (int i = 0; i < exponent; i++)
+        {
+            if (mantissa > max_uint / 100)
+            {
+                return FALSE;
+            }
+
+            mantissa *= 100;
+        }
+
+        if (type & OCI_NUM_UNSIGNED)
+        {
+            if (negative)
+            {
+                return FALSE;
+            }
+        }
+        else
+        {
+            max_value = (max_uint >> 1) + (negative ? 1 : 0);
+        }
+
+        if (mantissa > max_value)
+        {
+            return FALSE;
+        }
+
+        if (negative)
+        {
+            mantissa = (~mantissa) + 1;
+        }
+
+        if (type & OCI_NUM_SHORT)
+        {
+            *((unsigned short *) value) = (unsigned short) mantissa;
+        }
+        else if (type & OCI_NUM_INT)
+        {
+            *((unsigned int *) value) = (unsigned int) mantissa;
+        }
+        else
+        {
+            *((big_uint *) value) = mantissa;
+        }
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberEncode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberEncode
+(
+    const void *value,
+    uword       type,
+    OCINumber  *number
+)
+{
+    /* Encode integers and integral floating point values into the Oracle NUMBER internal format
+       (see OCI_NumberDecode()). Floating point values are only encoded natively when they have
+       less significant digits than the OCI conversion precision, otherwise FALSE is returned and
+       the caller must rely on OCI conversions
+    */
+
+    ub1 *part = number->OCINumberPart;
+    ub1  digits[OCI_NUMBER_SIZE];
+
+    boolean  negative = FALSE;
+    big_uint mantissa = 0;
+    int nb_digits = 0;
+    int first = 0;
+
+    if (!value)
+    {
+        return FALSE;
+    }
+
+    if (type & OCI_NUM_DOUBLE || type & OCI_NUM_FLOAT)
+    {
+        const double real  = (type & OCI_NUM_DOUBLE) ? *((double *) value) : (double) *((float *) value);
+        const double limit = (type & OCI_NUM_DOUBLE) ? OCI_NUMBER_DOUBLE_MAX_EXACT : OCI_NUMBER_FLOAT_MAX_EXACT;
+
+        /* NaN values also fail the range check */
+
+        if (!(real > -limit && real < limit) || (real != (double) (big_int) real))
+        {
+            return FALSE;
+        }
+
+        negative = (real < 0);
+        mantissa = (big_uint) (negative ? -real : real);
+    }
+    else if (type & OCI_NUM_SHORT)
+    {
+        const big_int integer = (type & OCI_NUM_UNSIGNED) ? (big_int) *((unsigned short *) value) : (big_int) *((short *) value);
+
+        negative = (integer < 0);
+        mantissa = negative ? (big_uint) -integer : (big_uint) integer;
+    }
+    else if (type & OCI_NUM_INT)
+    {
+        const big_int integer = (type & OCI_NUM_UNSIGNED) ? (big_int) *((unsigned int *) value) : (big_int) *((int *) value);
+
+        negative = (integer < 0);
+        mantissa = negative ? (big_uint) -integer : (big_uint) integer;
+    }
+    else if (type & OCI_NUM_BIGINT)
+    {
+        if (type & OCI_NUM_UNSIGNED)
+        {
+            mantissa = *((big_uint *) value);
+        }
+        else
+        {
+            const big_int integer = *((big_int *) value);
+
+            /* computed on unsigned values for handling the minimum value */
+
+            negative = (integer < 0);
+            mantissa = negative ? ((big_uint) 0) - (big_uint) integer : (big_uint) integer;
+        }
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    memset(number, 0, sizeof(*number));
+
+    if (0 == mantissa)
+    {
+        part[0] = 1;
+        part[1] = OCI_NUMBER_EXP_ZERO;
+
+        return TRUE;
+    }
+
+    /* extract base 100 digits from the least significant one and skip trailing zero digits */
+
+    while (mantissa > 0)
+    {
+        digits[nb_digits++] = (ub1) (mantissa % 100);
+        mantissa /= 100;
+    }
+
+    while (0 == digits[first])
+    {
+        first++;
+    }
+
+    part[0] = (ub1) (1 + nb_digits - first);
+
+    if (negative)
+    {
+        part[1] = (ub1) (OCI_NUMBER_EXP_NEGATIVE - (nb_digits - 1));
+
+        for (int i = nb_digits - 1, j = 2; i >= first; i--, j++)
+        {
+            part[j] = (ub1) (OCI_NUMBER_NEG_DIGIT_BASE - digits[i]);
+        }
+
+        if (part[0] < OCI_NUMBER_SIZE - 1)
+        {
+            part[++part[0]] = OCI_NUMBER_NEG_TERMINATOR;
+        }
+    }
+    else
+    {
+        part[1] = (ub1) (OCI_NUMBER_EXP_POSITIVE + (nb_digits - 1));
+
+        for (int i = nb_digits - 1, j = 2; i >= first; i--, j++)
+        {
+            part[j] = (ub1) (digits[i] + 1);
+        }
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_TranslateNumericArray
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_TranslateNumericArray
+(
+    OCI_Connection *con,
+    void           *in_values,
+    uword           in_type,
+    ub4             in_stride,
+    OCIInd         *in_inds,
+    void           *out_values,
+    uword           out_type,
+    ub4             count
+)
+{
+    const uword out_size = OCI_GetNumericTypeSize(out_type);
+
+    ub1 *in  = (ub1 *) in_values;
+    ub1 *out = (ub1 *) out_values;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+
+    OCI_CHECK(NULL == in_values, FALSE)
+    OCI_CHECK(NULL == out_values, FALSE)
+
+    OCI_CALL_CONTEXT_SET_FROM_CONN(con)
+
+    /* null values are translated to zero, OCINumber values are natively decoded or encoded
+       when possible */
+
+    for (ub4 i = 0; (i < count) && OCI_STATUS; i++, in += in_stride, out += out_size)
+    {
+        boolean done = FALSE;
+
+        if (in_inds && (OCI_IND_NULL == in_inds[i]))
+        {
+            memset(out, 0, out_size);
+            done = TRUE;
+        }
+        else if (OCI_NUM_NUMBER == in_type)
+        {
+            done = OCI_NumberDecode((OCINumber *) in, out, out_type);
+        }
+        else if (OCI_NUM_NUMBER == out_type)
+        {
+            done = OCI_NumberEncode(in, in_type, (OCINumber *) out);
+        }
+
+        if (!done)
+        {
+            OCI_STATUS = OCI_TranslateNumericValue(con, in, in_type, out, out_type);
+        }
+    }
+
+    return OCI_STATUS;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_TranslateNumericValue
  * --------------------------------------------------------------------------------------------- */
@@ -137,7 +530,13 @@ boolean OCI_TranslateNumericValue
     }
     else if (OCI_NUM_NUMBER == in_type)
     {
-        if (out_type & OCI_NUM_DOUBLE || out_type & OCI_NUM_FLOAT)
+        /* try first a native decoding that does not require any OCI call */
+
+        if (OCI_NumberDecode((OCINumber *) in_value, out_value, out_type))
+        {
+            OCI_STATUS = TRUE;
+        }
+        else if (out_type & OCI_NUM_DOUBLE || out_type & OCI_NUM_FLOAT)
         {
             /* OCINumber to double / float */
 
@@ -150,6 +549,12 @@ boolean OCI_TranslateNumericValue
             OCI_EXEC(OCINumberToInt(ctx->oci_err, in_value, out_size, out_sign, out_value))
         }
     }
+    else if ((OCI_NUM_NUMBER == out_type) && OCI_NumberEncode(in_value, in_type, (OCINumber *) out_value))
+    {
+        /* integers and integral real values natively encoded without any OCI call */
+
+        OCI_STATUS = TRUE;
+    }
     else if (in_type & OCI_NUM_DOUBLE || in_type & OCI_NUM_FLOAT)
     {
         if (out_type == OCI_NUM_NUMBER)
@@ -447,11 +852,9 @@ boolean OCI_NumberToString
                                 (ub4 *)&dbsize1, (oratext *)dbstr1)
             )
 
-            OCI_StringCopyOracleStringToNativeString(dbstr1, out_value, dbcharcount(dbsize1));
+            out_value_size = OCI_StringCopyOracleStringToNativeString(dbstr1, out_value, dbcharcount(dbsize1));
             OCI_StringReleaseOracleString(dbstr2);
             OCI_StringReleaseOracleString(dbstr1);
-
-            out_value_size = (dbsize1 / (int) sizeof(dbtext));
         }
     }
 
@@ -235,8 +235,9 @@
 #define OCI_IPC_DP_COL_ARRAY     61
 #define OCI_IPC_BATCH_ERRORS     62
 #define OCI_IPC_STATEMENT_ARRAY  63
+#define OCI_IPC_COLUMN_CACHE     64
 
-#define OCI_IPC_COUNT            (OCI_IPC_STATEMENT_ARRAY + 2)
+#define OCI_IPC_COUNT            (OCI_IPC_COLUMN_CACHE + 2)
 
 /* --------------------------------------------------------------------------------------------- *
  * Oracle conditional features
@@ -302,6 +303,16 @@
 #define OCI_BIND_INPUT                  1
 #define OCI_BIND_OUTPUT                 2
 
+/* --------------------------------------------------------------------------------------------- *
+ * hash tables
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_HASH_MIN_SIZE               16
+#define OCI_HASH_MAX_SIZE               0x40000000u
+#define OCI_HASH_USED_SLOT              0x80000000u
+#define OCI_HASH_FNV_BASIS              2166136261u
+#define OCI_HASH_FNV_PRIME              16777619u
+
 /* --------------------------------------------------------------------------------------------- *
  * Type of schema describing
  * --------------------------------------------------------------------------------------------- */
@@ -368,8 +379,28 @@
 
 
 #define OCI_UTF8_BYTES_PER_CHAR 4
+
+/* UTF-16 surrogates */
+
+#define OCI_UTF16_REPLACEMENT       0xFFFD
+
+#define OCI_UTF16_IS_SURROGATE(c)   (((c) & 0xF800) == 0xD800)
+#define OCI_UTF16_IS_HIGH(c)        (((c) & 0xFC00) == 0xD800)
+#define OCI_UTF16_IS_LOW(c)         (((c) & 0xFC00) == 0xDC00)
 #define OCI_SIZE_TMP_CVT        128
 
+/* adaptive fetch size */
+
+#define OCI_FETCH_SIZE_MAX      65535   /* upper bound of adaptive fetch sizes */
+#define OCI_FETCH_HANDLE_SIZE   256     /* estimated memory used by an OCI descriptor or handle */
+
+/* user structure members retrieval modes */
+
+#define OCI_SMM_COPY            1       /* numeric value copied from the fetch buffer */
+#define OCI_SMM_NUMERIC         2       /* numeric value converted from the fetch buffer */
+#define OCI_SMM_DATA            3       /* pointer to the fetch buffer */
+#define OCI_SMM_HANDLE          4       /* handle retrieved for the current row */
+
 /* --------------------------------------------------------------------------------------------- *
  * Local helper macros
  * --------------------------------------------------------------------------------------------- */
@@ -383,6 +414,115 @@
 
 #define OCI_FREE(ptr)                   { OCI_MemFree(ptr), (ptr) = NULL; }
 
+/* lock-free counters helpers */
+
+#if defined(_WINDOWS)
+
+    #define OCI_ATOMIC_ENABLED
+
+    #define OCI_ATOMIC_ADD(ptr, value)      InterlockedExchangeAdd((volatile LONG *) (ptr), (LONG) (value))
+    #define OCI_ATOMIC_ADD_BIG(ptr, value)  InterlockedExchangeAdd64((volatile LONGLONG *) (ptr), (LONGLONG) (value))
+    #define OCI_ATOMIC_LOCK(ptr)            InterlockedExchange((volatile LONG *) (ptr), 1)
+    #define OCI_ATOMIC_UNLOCK(ptr)          InterlockedExchange((volatile LONG *) (ptr), 0)
+    #define OCI_ATOMIC_PAUSE()              YieldProcessor()
+
+#elif defined(__GNUC__)
+
+    #define OCI_ATOMIC_ENABLED
+
+    #define OCI_ATOMIC_ADD(ptr, value)      __sync_fetch_and_add((ptr), (value))
+    #define OCI_ATOMIC_ADD_BIG(ptr, value)  __sync_fetch_and_add((ptr), (value))
+    #define OCI_ATOMIC_LOCK(ptr)            __sync_lock_test_and_set((ptr), 1)
+    #define OCI_ATOMIC_UNLOCK(ptr)          __sync_lock_release((ptr))
+
+    #if defined(__i386__) || defined(__x86_64__)
+        #define OCI_ATOMIC_PAUSE()          __builtin_ia32_pause()
+    #elif defined(__aarch64__) || defined(__arm__)
+        #define OCI_ATOMIC_PAUSE()          __asm__ __volatile__("yield")
+    #else
+        #include <sched.h>
+        #define OCI_ATOMIC_PAUSE()          sched_yield()
+    #endif
+
+#endif
+
+/* spin lock waiting on a read of the lock value between attempts */
+
+#define OCI_SPIN_LOCK(ptr)                                                      \
+                                                                                \
+    while (OCI_ATOMIC_LOCK(ptr))                                                \
+    {                                                                           \
+        while (*(ptr))                                                          \
+        {                                                                       \
+            OCI_ATOMIC_PAUSE();                                                 \
+        }                                                                       \
+    }
+
+#define OCI_SPIN_UNLOCK(ptr)            OCI_ATOMIC_UNLOCK(ptr);
+
+/* thread local storage */
+
+#if defined(_MSC_VER)
+
+    #define OCI_THREAD_LOCAL                __declspec(thread)
+
+#elif defined(__GNUC__)
+
+    #define OCI_THREAD_LOCAL                __thread
+
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+
+    #define OCI_THREAD_LOCAL                _Thread_local
+
+#endif
+
+/* memory counters sharding */
+
+#define OCI_MEM_COUNTERS_BITS           4
+#define OCI_MEM_COUNTERS_COUNT          (1 << OCI_MEM_COUNTERS_BITS)
+#define OCI_CACHE_LINE_SIZE             64
+
+#if defined(_MSC_VER)
+
+    #define OCI_CACHE_ALIGNED               __declspec(align(OCI_CACHE_LINE_SIZE))
+
+#elif defined(__GNUC__)
+
+    #define OCI_CACHE_ALIGNED               __attribute__((aligned(OCI_CACHE_LINE_SIZE)))
+
+#else
+
+    #define OCI_CACHE_ALIGNED
+
+#endif
+
+/* memory pools for small fixed size structures */
+
+#if defined(OCI_ATOMIC_ENABLED) && defined(OCI_THREAD_LOCAL)
+
+    #define OCI_MEM_POOL_ENABLED
+
+#endif
+
+#define OCI_MEM_POOL_COUNT              12
+#define OCI_MEM_POOL_CACHE_SIZE         64    /* free blocks kept per pool by each thread */
+#define OCI_MEM_POOL_MAX_FREE           4096  /* free blocks kept per pool in the shared pool */
+#define OCI_MEM_POOL_STATS_PERIOD       1024  /* operations before publishing thread statistics */
+
+/* vectorized string transcoding */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+    #define OCI_SIMD_SSE2
+
+#endif
+
+#if defined(OCI_SIMD_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+    #define OCI_SIMD_AVX2
+
+#endif
+
 /* indicator and nullity handlers */
 
 #define OCI_IND(exp)                    (sb2) ((exp) ? 0 : -1)
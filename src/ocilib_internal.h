@@ -83,6 +83,148 @@ boolean OCI_ArrayFreeFromHandles
     void ** handles
 );
 
+/* --------------------------------------------------------------------------------------------- *
+ * arrow.c
+ * --------------------------------------------------------------------------------------------- */
+
+const OCI_ArrowType * OCI_ArrowGetType
+(
+    OCI_Define *def
+);
+
+size_t OCI_ArrowEncodeUTF8
+(
+    const void *src,
+    size_t      char_size,
+    size_t      len,
+    ub1        *dst
+);
+
+char * OCI_ArrowGetName
+(
+    const otext *name
+);
+
+big_int OCI_ArrowGetDays
+(
+    int year,
+    int month,
+    int day
+);
+
+void OCI_ArrowColumnFree
+(
+    OCI_ArrowColumn *col
+);
+
+ub1 * OCI_ArrowColumnAlloc
+(
+    OCI_ArrowColumn *col,
+    ub4              index,
+    size_t           size
+);
+
+boolean OCI_ArrowColumnBuild
+(
+    OCI_Define          *def,
+    const OCI_ArrowType *type,
+    ub4                  offset,
+    ub4                  count,
+    OCI_ArrowColumn     *col
+);
+
+void OCI_ArrowSchemaRelease
+(
+    struct ArrowSchema *schema
+);
+
+void OCI_ArrowArrayRelease
+(
+    struct ArrowArray *array
+);
+
+size_t OCI_ArrowMessageAlloc
+(
+    OCI_ArrowMessage *msg,
+    size_t            size,
+    size_t            align,
+    size_t            bias
+);
+
+void OCI_ArrowMessagePut
+(
+    OCI_ArrowMessage *msg,
+    size_t            pos,
+    big_uint          value,
+    size_t            size
+);
+
+void OCI_ArrowMessageLink
+(
+    OCI_ArrowMessage *msg,
+    size_t            field,
+    size_t            target
+);
+
+size_t OCI_ArrowMessageTable
+(
+    OCI_ArrowMessage *msg,
+    ub2               count,
+    const ub1        *sizes,
+    size_t           *fields
+);
+
+size_t OCI_ArrowMessageVector
+(
+    OCI_ArrowMessage *msg,
+    ub4               count,
+    size_t            elem_size
+);
+
+size_t OCI_ArrowMessageString
+(
+    OCI_ArrowMessage *msg,
+    const char       *str
+);
+
+size_t OCI_ArrowMessageHeader
+(
+    OCI_ArrowMessage *msg,
+    ub1               type,
+    big_uint          body_size
+);
+
+void OCI_ArrowMessageSchema
+(
+    OCI_ArrowMessage *msg,
+    OCI_Resultset    *rs
+);
+
+void OCI_ArrowMessageRecordBatch
+(
+    OCI_ArrowMessage *msg,
+    OCI_ArrowColumn  *cols,
+    ub4               nb_cols,
+    ub4               count
+);
+
+boolean OCI_ArrowStreamWrite
+(
+    OCI_Resultset *rs,
+    int            fd,
+    const void    *data,
+    size_t         size
+);
+
+boolean OCI_ArrowStreamMessage
+(
+    OCI_Resultset    *rs,
+    int               fd,
+    OCI_ArrowMessage *msg,
+    OCI_ArrowColumn  *cols,
+    ub4               nb_cols
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * bind.c
  * --------------------------------------------------------------------------------------------- */
@@ -217,6 +359,18 @@ boolean OCI_ColumnGetAttrInfo
     size_t        *p_align
 );
 
+OCI_ColumnCache * OCI_ColumnCacheGet
+(
+    OCI_Statement *stmt,
+    ub4            count,
+    boolean       *valid
+);
+
+boolean OCI_ColumnCacheFree
+(
+    OCI_Statement *stmt
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * connection.c
  * --------------------------------------------------------------------------------------------- */
@@ -284,6 +438,36 @@ boolean OCI_DefineGetNumber
     uword          type
 );
 
+void OCI_DefineExpandStrings
+(
+    OCI_Define *def,
+    ub4         offset,
+    ub4         count
+);
+
+ub4 OCI_DefineGetLength
+(
+    OCI_Define *def,
+    ub4         row
+);
+
+void OCI_DefineSetLength
+(
+    OCI_Define *def,
+    ub4         row,
+    ub4         len
+);
+
+boolean OCI_DefineIsPlainBuffer
+(
+    OCI_Define *def
+);
+
+unsigned int OCI_DefineGetRowSize
+(
+    OCI_Define *def
+);
+
 boolean OCI_DefineAlloc
 (
     OCI_Define *def
@@ -343,6 +527,17 @@ void OCI_ErrorReset
     OCI_Error *err
 );
 
+void OCI_ErrorUpdatePending
+(
+    OCI_Error *err
+);
+
+void OCI_ErrorGetOracleMessage
+(
+    OCI_Error *err,
+    dvoid     *handle
+);
+
 OCI_Error * OCI_ErrorGet
 (
     boolean check,
@@ -372,6 +567,11 @@ void OCI_ExceptionRaise
     OCI_Error *err
 );
 
+const otext * OCI_ExceptionGetTypeName
+(
+    int type
+);
+
 void OCI_ExceptionOCI
 (
     OCIError       *p_err,
@@ -562,6 +762,12 @@ void OCI_ExceptionExternalBindingNotAllowed
     const otext   *bind
 );
 
+void OCI_ExceptionStreamWrite
+(
+    OCI_Statement *stmt,
+    int            code
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * file.c
  * --------------------------------------------------------------------------------------------- */
@@ -596,9 +802,26 @@ int OCI_ParseSqlFmt
  * --------------------------------------------------------------------------------------------- */
 
 unsigned int OCI_HashCompute
+(
+    const otext *str
+);
+
+OCI_HashEntry * OCI_HashFind
+(
+    OCI_HashTable *table,
+    const otext   *key
+);
+
+boolean OCI_HashResize
+(
+    OCI_HashTable *table,
+    unsigned int   size
+);
+
+OCI_HashEntry * OCI_HashInsert
 (
     OCI_HashTable *table,
-    const otext   *str
+    const otext   *key
 );
 
 boolean OCI_HashAdd
@@ -884,6 +1107,71 @@ void OCI_MemUpdateBytes
     big_int  size
 );
 
+OCI_MemoryCounter * OCI_MemGetCounter
+(
+    void
+);
+
+big_uint OCI_MemGetBytes
+(
+    int type
+);
+
+int OCI_MemPoolGetIndex
+(
+    int    type,
+    size_t size
+);
+
+#ifdef OCI_MEM_POOL_ENABLED
+
+OCI_MemoryCache * OCI_MemPoolGetCache
+(
+    void
+);
+
+void OCI_MemPoolPublish
+(
+    OCI_MemoryPool      *pool,
+    OCI_MemoryPoolCache *cache
+);
+
+void OCI_MemPoolRelease
+(
+    OCI_MemoryPool *pool,
+    void           *head,
+    void           *tail,
+    unsigned int    count
+);
+
+void * OCI_MemPoolAlloc
+(
+    int index
+);
+
+boolean OCI_MemPoolFree
+(
+    int   index,
+    void *block
+);
+
+void OCI_MemPoolCacheFlush
+(
+    OCI_MemoryCache *cache
+);
+
+void OCI_MemPoolCacheFree
+(
+    OCI_MemoryCache *cache
+);
+
+void OCI_MemPoolCleanup
+(
+    void
+);
+
+#endif
+
 /* --------------------------------------------------------------------------------------------- *
  * mutex.c
  * --------------------------------------------------------------------------------------------- */
@@ -897,6 +1185,37 @@ OCI_Mutex * OCI_MutexCreateInternal
  * number.c
  * --------------------------------------------------------------------------------------------- */
 
+uword OCI_GetNumericTypeSize
+(
+    unsigned int type
+);
+
+boolean OCI_NumberDecode
+(
+    const OCINumber *number,
+    void            *value,
+    uword            type
+);
+
+boolean OCI_NumberEncode
+(
+    const void *value,
+    uword       type,
+    OCINumber  *number
+);
+
+boolean OCI_TranslateNumericArray
+(
+    OCI_Connection *con,
+    void           *in_values,
+    uword           in_type,
+    ub4             in_stride,
+    OCIInd         *in_inds,
+    void           *out_values,
+    uword           out_type,
+    ub4             count
+);
+
 boolean OCI_TranslateNumericValue
 (
     OCI_Connection *con,
@@ -1005,6 +1324,112 @@ boolean OCI_ResultsetFree
     OCI_Resultset *rs
 );
 
+boolean OCI_FetchSizeAdjust
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchSizeGrow
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchPipelineCreate
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchPipelineFree
+(
+    OCI_Resultset *rs
+);
+
+void OCI_FetchPipelineSwap
+(
+    OCI_Resultset *rs
+);
+
+void OCI_FetchPipelineProc
+(
+    OCI_Thread *thread,
+    void       *arg
+);
+
+boolean OCI_FetchPipelineStart
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchPipelineJoin
+(
+    OCI_Resultset *rs
+);
+
+sword OCI_FetchPipelineWait
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchCacheCreate
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchCacheFree
+(
+    OCI_Resultset *rs
+);
+
+void OCI_FetchCacheClear
+(
+    OCI_FetchCache *cache
+);
+
+void OCI_FetchCacheUnlink
+(
+    OCI_FetchCache  *cache,
+    OCI_FetchWindow *win
+);
+
+void OCI_FetchCacheLink
+(
+    OCI_FetchCache  *cache,
+    OCI_FetchWindow *win
+);
+
+boolean OCI_FetchCacheStore
+(
+    OCI_Resultset *rs,
+    ub4            first
+);
+
+boolean OCI_FetchCacheLoad
+(
+    OCI_Resultset *rs,
+    ub4            row
+);
+
+boolean OCI_FetchCacheMove
+(
+    OCI_Resultset *rs,
+    ub4            row,
+    boolean        backward,
+    boolean       *success
+);
+
+boolean OCI_StructLayoutCreate
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_StructFill
+(
+    OCI_Resultset *rs,
+    ub4            row,
+    void          *row_struct,
+    boolean       *inds
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * statement.c
  * --------------------------------------------------------------------------------------------- */
@@ -1026,6 +1451,42 @@ boolean OCI_StatementClose
     OCI_Statement *stmt
 );
 
+boolean OCI_StatementDispose
+(
+    OCI_Statement *stmt
+);
+
+boolean OCI_StatementCacheReset
+(
+    OCI_Statement *stmt
+);
+
+boolean OCI_StatementCacheRelease
+(
+    OCI_Statement *stmt
+);
+
+boolean OCI_StatementCacheSetLimit
+(
+    OCI_Connection *con,
+    unsigned int    limit
+);
+
+ub4 OCI_StatementGetChunkSize
+(
+    OCI_Statement *stmt,
+    ub4            iters,
+    ub4            mode
+);
+
+sword OCI_StatementExecuteChunks
+(
+    OCI_Statement *stmt,
+    ub4            iters,
+    ub4            chunk,
+    ub4            mode
+);
+
 OCI_Statement * OCI_StatementInit
 (
     OCI_Connection *con,
@@ -1071,7 +1532,23 @@ boolean OCI_StringRequestBuffer
     unsigned int    request_size
 );
 
-void OCI_StringTranslate
+int OCI_StringUTF16ToUTF32Count
+(
+    const unsigned short *src,
+    unsigned int         *dst,
+    int                   count
+);
+
+int OCI_StringUTF32ToUTF16Count
+(
+    const unsigned int *src,
+    unsigned short     *dst,
+    int                 count,
+    int                 capacity,
+    int                *done
+);
+
+int OCI_StringTranslate
 (
     void  *src,
     void  *dst,
@@ -1200,6 +1677,11 @@ void OCI_ThreadProc
     dvoid *arg
 );
 
+boolean OCI_ThreadReset
+(
+    OCI_Thread *thread
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * threadkey.c
  * --------------------------------------------------------------------------------------------- */
@@ -40,6 +40,67 @@ struct OCI_MemoryBlock
 
 typedef struct OCI_MemoryBlock OCI_MemoryBlock;
 
+/*
+ * Memory counters
+ *
+ * Allocated bytes are accounted in several counters aligned and padded to a
+ * cache line in order to avoid contention between threads allocating
+ * concurrently. Each thread is given its own counter at its first allocation
+ *
+ */
+
+struct OCI_CACHE_ALIGNED OCI_MemoryCounter
+{
+    big_int oci;                                                   /* allocated bytes by OCI client */
+    big_int lib;                                                   /* allocated bytes by OCILIB */
+    char    padding[OCI_CACHE_LINE_SIZE - 2 * sizeof(big_int)];    /* avoid false sharing */
+};
+
+typedef struct OCI_MemoryCounter OCI_MemoryCounter;
+
+/*
+ * Memory pools
+ *
+ * Small fixed size structures are recycled through per type free lists.
+ * Each thread owns a cache of free blocks per pool and exchanges batches
+ * of blocks with the shared pool only when its cache is empty or full
+ *
+ */
+
+struct OCI_MemoryPool
+{
+    void         *head;     /* shared list of free blocks */
+    unsigned int  count;    /* number of blocks in the shared list */
+    volatile long lock;     /* spin lock protecting the shared list */
+    big_int       allocs;   /* number of allocations */
+    big_int       hits;     /* number of allocations served from the pool */
+    big_int       frees;    /* number of deallocations */
+};
+
+typedef struct OCI_MemoryPool OCI_MemoryPool;
+
+struct OCI_MemoryPoolCache
+{
+    void         *head;     /* thread list of free blocks */
+    unsigned int  count;    /* number of blocks in the thread list */
+    unsigned int  allocs;   /* allocations not yet published to the shared pool */
+    unsigned int  hits;     /* hits not yet published to the shared pool */
+    unsigned int  frees;    /* deallocations not yet published to the shared pool */
+};
+
+typedef struct OCI_MemoryPoolCache OCI_MemoryPoolCache;
+
+struct OCI_MemoryCache
+{
+    OCI_MemoryPoolCache     pools[OCI_MEM_POOL_COUNT];  /* per pool thread caches */
+    struct OCI_ThreadKey   *key;                        /* thread key the cache is registered with */
+    struct OCI_MemoryCache *prev;                       /* previous cache in the list of thread caches */
+    struct OCI_MemoryCache *next;                       /* next cache in the list of thread caches */
+    boolean                 registered;                 /* is the cache in the list of thread caches ? */
+};
+
+typedef struct OCI_MemoryCache OCI_MemoryCache;
+
 /*
  * OCI_Item : Internal list entry.
  *
@@ -131,6 +192,7 @@ struct OCI_Error
     int             libcode;                  /* OCILIB internal error code */
     unsigned int    type;                     /* OCILIB error type */
     ub4             row;                      /* Error row offset (array DML) */
+    boolean         str_oracle;               /* message not yet converted from Oracle charset */
     otext           str[OCI_ERR_MSG_SIZE+1];  /* error message */
 };
 
@@ -211,15 +273,16 @@ struct OCI_Library
     OCI_Error            lib_err;                 /* Global error */
     OCI_HashTable       *key_map;                 /* hash table for mapping name/key */
     OCI_ThreadKey       *key_errs;                /* Thread key to store thread errors */
+    OCI_ThreadKey       *key_mem;                 /* Thread key to release thread memory caches */
     unsigned int         nb_hndlp;                /* number of OCI handles allocated */
     unsigned int         nb_descp;                /* number of OCI descriptors allocated */
     unsigned int         nb_objinst;              /* number of OCI objects allocated */
     OCI_HashTable       *sql_funcs;               /* hash table handle for sql function names */
     POCI_HA_HANDLER      ha_handler;              /* HA event callback*/
     otext               *formats[OCI_FMT_COUNT];  /* string conversion default formats */
-    big_uint             mem_bytes_oci;           /* allocated bytes by OCI client */
-    big_uint             mem_bytes_lib;           /* allocated bytes by OCILIB */
-    OCI_Mutex           *mem_mutex;               /* mutex for memory counters */
+    OCI_MemoryCounter    mem_bytes[OCI_MEM_COUNTERS_COUNT]; /* allocated bytes counters */
+    OCI_Mutex           *mem_mutex;               /* mutex for memory counters without atomic support */
+    OCI_MemoryPool       mem_pools[OCI_MEM_POOL_COUNT]; /* memory pools of small structures */
     void                *usrdata;                 /* user data */
     boolean              env_vars[OCI_VARS_COUNT];/* specific environment variables */
 #ifdef OCI_IMPORT_RUNTIME
@@ -251,6 +314,28 @@ struct OCI_Pool
     ub4          cache_size;    /* statement cache size */
 };
 
+/*
+ * Cache of idle prepared statements
+ *
+ */
+
+struct OCI_StatementCacheEntry
+{
+    unsigned int    hash;   /* hash code of the statement SQL */
+    OCI_Statement  *stmt;   /* idle statement */
+};
+
+typedef struct OCI_StatementCacheEntry OCI_StatementCacheEntry;
+
+struct OCI_StatementCache
+{
+    OCI_StatementCacheEntry *entries;   /* idle statements, most recently used first */
+    unsigned int             count;     /* number of idle statements */
+    unsigned int             limit;     /* maximum number of idle statements */
+};
+
+typedef struct OCI_StatementCache OCI_StatementCache;
+
 /*
  * Connection object
  *
@@ -290,6 +375,7 @@ struct OCI_Connection
     otext            *domain_name;  /* server domain name */
     OCI_Timestamp    *inst_startup; /* instance startup timestamp */
     otext            *formats[OCI_FMT_COUNT];  /* string conversion default formats */
+    OCI_StatementCache stmt_cache;  /* idle statements ready for reuse */
 };
 
 /*
@@ -383,6 +469,7 @@ struct OCI_Bind
     ub1             csfrm;       /* charset form */
     ub1             direction;   /* in, out or in/out bind */
     ub1             alloc_mode;  /* allocation mode : internal or external */
+    boolean         dirty;       /* modified since the last execution ? */
 }
 ;
 
@@ -393,14 +480,132 @@ struct OCI_Bind
 
 struct OCI_Define
 {
-    OCI_Resultset  *rs;   /* pointer to resultset object */
-    void           *obj;  /* current OCILIB object instance */
-    OCI_Column      col;  /* column object */
-    OCI_Buffer      buf;  /* placeholder */
+    OCI_Resultset  *rs;       /* pointer to resultset object */
+    void           *obj;      /* current OCILIB object instance */
+    OCI_Column      col;      /* column object */
+    OCI_Buffer      buf;      /* placeholder */
+    ub1            *expanded; /* bitmap of text rows already expanded to wide strings */
 };
 
 typedef struct OCI_Define OCI_Define;
 
+/*
+ * OCI_FetchPipeline : background fetch of the next array of rows
+ *
+ */
+
+struct OCI_FetchPipeline
+{
+    OCI_Thread *thread;             /* helper thread running the background fetch */
+    OCIError   *err;                /* OCI error handle used by the helper thread */
+    OCI_Buffer *bufs;               /* spare buffers of each define */
+    sword       status;             /* status of the background fetch */
+    boolean     pending;            /* background fetch in progress ? */
+    boolean     ready;              /* background fetch completed but its rows not consumed yet ? */
+    boolean     stopped;            /* background fetches disabled after a thread failure ? */
+};
+
+typedef struct OCI_FetchPipeline OCI_FetchPipeline;
+
+/*
+ * OCI_FetchWindow : copy of an array of rows fetched from a scrollable cursor
+ *
+ */
+
+struct OCI_FetchWindow
+{
+    ub4                     first;  /* absolute position of the first row */
+    ub4                     count;  /* number of rows */
+    sword                   status; /* status of the fetch call that retrieved the rows */
+    size_t                  size;   /* size of the copied buffers */
+    ub1                    *data;   /* data, indicators and lengths of each define */
+    struct OCI_FetchWindow *prev;   /* more recently used window */
+    struct OCI_FetchWindow *next;   /* less recently used window */
+};
+
+typedef struct OCI_FetchWindow OCI_FetchWindow;
+
+/*
+ * OCI_FetchCache : client side cache of the arrays of rows fetched from a scrollable cursor
+ *
+ */
+
+struct OCI_FetchCache
+{
+    OCI_FetchWindow *head;          /* most recently used window */
+    OCI_FetchWindow *tail;          /* least recently used window */
+    ub4              rows;          /* number of cached rows */
+    size_t           size;          /* memory used by cached rows */
+    ub4              max_rows;      /* maximum number of cached rows (0 for no limit) */
+    size_t           max_size;      /* maximum memory used by cached rows (0 for no limit) */
+    ub4              row_last;      /* absolute position of the last row when known */
+};
+
+typedef struct OCI_FetchCache OCI_FetchCache;
+
+/*
+ * Member of a user structure filled by OCI_GetStruct()
+ *
+ */
+
+struct OCI_StructMember
+{
+    size_t  offset;     /* offset of the member in the user structure */
+    size_t  size;       /* size of the member */
+    ub2     type;       /* numeric type of the member */
+    ub1     mode;       /* retrieval mode (OCI_SMM_XXX) */
+};
+
+typedef struct OCI_StructMember OCI_StructMember;
+
+/*
+ * OCI_ArrowType : Arrow type a column is exported to
+ *
+ */
+
+struct OCI_ArrowType
+{
+    const char *format;     /* C data interface format string */
+    ub1         type_id;    /* IPC type union identifier */
+    ub1         param;      /* bit width (Int), precision (FloatingPoint) or unit (Timestamp) */
+    ub1         is_signed;  /* signed integer ? */
+    ub1         width;      /* size of a value in bytes, 0 for bits and variable size values */
+    uword       subtype;    /* numeric type values are converted to */
+    const char *timezone;   /* time zone of timestamps */
+};
+
+typedef struct OCI_ArrowType OCI_ArrowType;
+
+/*
+ * OCI_ArrowColumn : Arrow buffers holding the values of a column for a batch of rows
+ *
+ */
+
+struct OCI_ArrowColumn
+{
+    const void *buffers[3]; /* validity bitmap, offsets or values, values */
+    size_t      sizes[3];   /* size in bytes of each buffer */
+    ub4         nb_buffers; /* number of buffers */
+    ub4         count;      /* number of values */
+    ub4         null_count; /* number of null values */
+};
+
+typedef struct OCI_ArrowColumn OCI_ArrowColumn;
+
+/*
+ * OCI_ArrowMessage : flatbuffer encoded metadata of an Arrow IPC message
+ *
+ */
+
+struct OCI_ArrowMessage
+{
+    ub1    *data;           /* encoded bytes */
+    size_t  size;           /* number of encoded bytes */
+    size_t  alloc;          /* allocated size */
+};
+
+typedef struct OCI_ArrowMessage OCI_ArrowMessage;
+
 /*
  * Resultset object
  *
@@ -416,10 +621,18 @@ struct OCI_Resultset
     ub4            row_abs;         /* absolute position in the resultset */
     ub4            row_count;       /* number of rows fetched so far */
     ub4            row_fetched;     /* rows fetched by last call (scrollable) */
+    ub4            batch_offset;    /* first row of the last batch in the array of rows */
+    ub4            batch_count;     /* number of rows of the last batch */
     boolean        eof;             /* end of resultset reached ?  */
     boolean        bof;             /* beginning of resultset reached ?  */
     ub4            fetch_size;      /* internal array size */
+    ub4            fetch_size_max;  /* upper bound of the internal array size (adaptive mode) */
     sword          fetch_status;    /* internal fetch status */
+    boolean        cols_cached;     /* is the select list description cached by the statement ? */
+    OCI_FetchPipeline *pipe;        /* background fetch of the next array of rows */
+    OCI_FetchCache    *cache;       /* cache of arrays of rows fetched from a scrollable cursor */
+    OCI_StructMember  *struct_members; /* user structure layout computed at first OCI_GetStruct() call */
+    size_t             struct_size;    /* size of the user structure */
 };
 
 /*
@@ -427,6 +640,22 @@ struct OCI_Resultset
  *
  */
 
+/*
+ * OCI_ColumnCache : select list description kept by a statement across executions
+ *
+ */
+
+struct OCI_ColumnCache
+{
+    otext         *sql;             /* SQL statement the select list was described for */
+    OCIStmt       *handle;          /* OCI statement handle the select list was described for */
+    OCI_Column    *cols;            /* columns description before mapping */
+    ub4            count;           /* number of columns */
+    OCI_HashTable *map;             /* hash table handle for mapping name/index */
+};
+
+typedef struct OCI_ColumnCache OCI_ColumnCache;
+
 struct OCI_BatchErrors
 {
     OCI_Error *errs;               /* sub array of OCILIB errors(array DML) */
@@ -462,10 +691,12 @@ struct OCI_Statement
     unsigned int     bind_alloc_mode;   /* type of bind allocation */
     ub4              exec_mode;         /* type of execution */
     ub4              fetch_size;        /* fetch array size */
+    ub4              fetch_mem;         /* memory budget for adaptive fetch sizes */
     ub4              prefetch_size;     /* pre-fetch size */
     ub4              prefetch_mem;      /* pre-fetch memory */
     ub4              long_size;         /* default size for LONG columns */
     ub1              long_mode;         /* LONG datatype handling mode */
+    POCI_LONG_HANDLER long_handler;     /* LONG pieces streaming callback */
     ub1              status;            /* statement status */
     ub2              type;              /* type of SQL statement */
     ub4              nb_iters;          /* current number of iterations for execution */
@@ -477,6 +708,16 @@ struct OCI_Statement
     boolean          bind_array;        /* has array binds ? */
     OCI_BatchErrors *batch;             /* error handling for array DML */
     ub2              err_pos;           /* error position in sql statement */
+    struct OCI_ColumnCache *cols_cache; /* select list description of the last executed query */
+    boolean          fetch_pipelined;   /* fetch the next array of rows in background ? */
+    ub4              fetch_cache_rows;  /* rows kept by the scrollable cursor cache */
+    ub4              fetch_cache_mem;   /* memory budget of the scrollable cursor cache */
+    boolean          cached;            /* returned to the connection cache when freed ? */
+    boolean          bind_tracking;     /* skip binds not modified since the last execution ? */
+    ub4              chunk_size;        /* maximum number of iterations per array DML round trip */
+    ub4              chunk_mem;         /* memory budget of bind data per array DML round trip */
+    boolean          chunked;           /* has the last execution been split into chunks ? */
+    ub4              chunk_rows;        /* affected rows of the last chunked execution */
 };
 
 /*
@@ -890,7 +1131,8 @@ typedef struct OCI_Array OCI_Array;
 struct OCI_HashTable
 {
     OCI_HashEntry **items;        /* array of slots */
-    unsigned int    size;         /* size of the slots array */
+    unsigned int   *hashes;       /* hash codes of the slots keys (0 for empty slots) */
+    unsigned int    size;         /* size of the slots array (power of 2) */
     unsigned int    count;        /* number of used slots */
     unsigned int    type;         /* type of data */
 };
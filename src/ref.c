@@ -393,12 +393,12 @@ boolean OCI_API OCI_RefToText
 
     OCI_EXEC(OCIRefToHex(ref->con->env, ref->con->err, ref->handle, (OraText *) dbstr, (ub4 *) &dbsize))
 
-    OCI_StringCopyOracleStringToNativeString(dbstr, str, dbcharcount(dbsize));
+    dbsize = OCI_StringCopyOracleStringToNativeString(dbstr, str, dbcharcount(dbsize));
     OCI_StringReleaseOracleString(dbstr);
 
     /* set null string terminator */
 
-    str[dbcharcount(dbsize)] = 0;
+    str[dbsize] = 0;
 
     OCI_RETVAL = OCI_STATUS;
 
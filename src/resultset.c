@@ -75,6 +75,30 @@ static unsigned int SeekModeValues[] = { OCI_SFD_ABSOLUTE, OCI_SFD_RELATIVE };
     }                                                                                           \
     OCI_CALL_EXIT()
 
+#define OCI_MATCHING_BATCH_TYPE(def)                                                            \
+    ((OCI_CDT_NUMERIC  == (def)->col.datatype) || (OCI_CDT_TEXT    == (def)->col.datatype) ||   \
+     (OCI_CDT_RAW      == (def)->col.datatype) || (OCI_CDT_BOOLEAN == (def)->col.datatype) ||   \
+     (OCI_CDT_DATETIME == (def)->col.datatype))
+
+/* moving the cursor row by row invalidates the last batch */
+
+#define OCI_RESET_BATCH(rs)                                                                     \
+    (rs)->batch_offset = 0;                                                                     \
+    (rs)->batch_count  = 0;
+
+#define OCI_GET_BATCH(rs, index, type, res, def)                                                \
+    OCI_CALL_ENTER(type, res)                                                                   \
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)                                                   \
+    OCI_CALL_CHECK_STMT_STATUS((rs)->stmt, OCI_STMT_EXECUTED)                                   \
+    OCI_CALL_CHECK_BOUND((rs)->stmt->con, index, 1, (rs)->nb_defs)                              \
+    OCI_CALL_CHECK_COMPAT((rs)->stmt->con, OCI_MATCHING_BATCH_TYPE(&(rs)->defs[(index) - 1]))   \
+    OCI_CALL_CONTEXT_SET_FROM_STMT((rs)->stmt)                                                  \
+    def = &(rs)->defs[(index) - 1];                                                             \
+    if (0 == (rs)->batch_count)                                                                 \
+    {                                                                                           \
+        OCI_CALL_JUMP_EXIT()                                                                    \
+    }
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ResultsetCreate
  * --------------------------------------------------------------------------------------------- */
@@ -132,6 +156,11 @@ OCI_Resultset * OCI_ResultsetCreate
 
         if (OCI_STATUS && (OCI_CST_SELECT == stmt->type))
         {
+            /* reuse the select list description of a previous execution of the same SQL statement */
+
+            boolean          cached = FALSE;
+            OCI_ColumnCache *cache  = OCI_ColumnCacheGet(stmt, nb, &cached);
+
             /* Compute columns information */
 
             for (i = 0; (i < nb) && OCI_STATUS; i++)
@@ -145,11 +174,35 @@ OCI_Resultset * OCI_ResultsetCreate
 
                 rs->nb_defs++;
 
-                /* get column description */
+                if (cached)
+                {
+                    /* get column description from cache */
+
+                    def->col      = cache->cols[i];
+                    def->col.name = ostrdup(cache->cols[i].name);
+
+                    OCI_STATUS = (NULL != def->col.name);
+                }
+                else
+                {
+                    /* get column description */
+
+                    OCI_STATUS = OCI_ColumnDescribe(&def->col, rs->stmt->con,
+                                                     rs->stmt, rs->stmt->stmt,
+                                                     i + 1, OCI_DESC_RESULTSET);
+
+                    /* columns depending on type info objects are not cached */
 
-                OCI_STATUS = OCI_ColumnDescribe(&def->col, rs->stmt->con,
-                                                 rs->stmt, rs->stmt->stmt,
-                                                 i + 1, OCI_DESC_RESULTSET);
+                    if (OCI_STATUS && cache && !def->col.typinf)
+                    {
+                        cache->cols[i]      = def->col;
+                        cache->cols[i].name = ostrdup(def->col.name);
+                    }
+                    else
+                    {
+                        cache = NULL;
+                    }
+                }
 
                 /* mapping to OCILIB internal types */
 
@@ -169,10 +222,34 @@ OCI_Resultset * OCI_ResultsetCreate
 
             }
 
+            /* keep the cache only if the full select list was described */
+
+            if (OCI_STATUS && cache)
+            {
+                rs->cols_cached = TRUE;
+
+                if (cached)
+                {
+                    rs->map    = cache->map;
+                    cache->map = NULL;
+                }
+            }
+            else
+            {
+                OCI_ColumnCacheFree(stmt);
+            }
+
             /* allocation internal buffers if needed */
 
             if (OCI_STATUS && !(rs->stmt->exec_mode & OCI_DESCRIBE_ONLY) && !(rs->stmt->exec_mode & OCI_PARSE_ONLY))
             {
+                /* size arrays of rows from the memory budget if requested */
+
+                if (stmt->fetch_mem > 0)
+                {
+                    OCI_STATUS = OCI_FetchSizeAdjust(rs);
+                }
+
                 for (i = 0; (i < nb) && OCI_STATUS; i++)
                 {
                     OCI_Define *def = &rs->defs[i];
@@ -182,6 +259,20 @@ OCI_Resultset * OCI_ResultsetCreate
 
                     OCI_STATUS = OCI_DefineAlloc(def) && OCI_DefineDef(def, i + 1);
                 }
+
+                /* set up background fetches if requested */
+
+                if (OCI_STATUS && stmt->fetch_pipelined)
+                {
+                    OCI_STATUS = OCI_FetchPipelineCreate(rs);
+                }
+
+                /* set up the cache of arrays of rows for scrollable cursors if requested */
+
+                if (OCI_STATUS && (stmt->fetch_cache_rows > 0 || stmt->fetch_cache_mem > 0))
+                {
+                    OCI_STATUS = OCI_FetchCacheCreate(rs);
+                }
             }
         }
         else if (rs->defs)
@@ -265,34 +356,85 @@ OCI_Resultset * OCI_ResultsetCreate
 
 
 /* --------------------------------------------------------------------------------------------- *
- * OCI_ResultsetExpandStrings
+ * OCI_ResultsetResetStrings
  * --------------------------------------------------------------------------------------------- */
 
-boolean OCI_ResultsetExpandStrings
+boolean OCI_ResultsetResetStrings
 (
     OCI_Resultset *rs
 )
 {
     OCI_CHECK(NULL == rs, FALSE)
 
+    /* newly fetched strings will be expanded to wide strings when accessed */
+
     for (ub4 i = 0; i < rs->nb_defs; i++)
     {
         OCI_Define *def = &rs->defs[i];
 
-        if (OCI_CDT_TEXT == def->col.datatype)
+        if (def->expanded)
         {
-            for (int j = (int) (def->buf.count-1); j >= 0; j--)
-            {
-                ub1 * tmpbuf = ((ub1*) def->buf.data) + (def->col.bufsize * j);
-
-                OCI_StringUTF16ToUTF32(tmpbuf, tmpbuf, (def->col.bufsize / sizeof(otext) ) -1);
-            }
+            memset(def->expanded, 0, (def->buf.count + 7) / 8);
         }
     }
 
     return TRUE;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPieceDeliver
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_FetchPieceDeliver
+(
+    OCI_Resultset *rs,
+    OCI_Define    *def,
+    OCI_Long      *lg,
+    ub4            iter,
+    boolean        last
+)
+{
+    ub4 size  = lg->size;
+    ub4 carry = 0;
+
+    if (OCI_CLONG == lg->type)
+    {
+        int len = (int) (size / sizeof(dbtext));
+
+        /* a surrogate pair split between two pieces is kept for the next one */
+
+        if (!last && OCILib.use_wide_char_conv && (len > 0) && OCI_UTF16_IS_HIGH(((dbtext *) lg->buffer)[len - 1]))
+        {
+            carry = ((dbtext *) lg->buffer)[--len];
+        }
+
+        ((dbtext *) lg->buffer)[len] = 0;
+
+        if (OCILib.use_wide_char_conv)
+        {
+            len = OCI_StringUTF16ToUTF32Count((unsigned short *) lg->buffer, (unsigned int *) lg->buffer, len);
+
+            ((otext *) lg->buffer)[len] = 0;
+        }
+
+        size = (ub4) len;
+    }
+
+    rs->stmt->long_handler(rs, (unsigned int) (def - rs->defs) + 1, rs->row_count + iter + 1,
+                           lg->buffer, (unsigned int) size, last);
+
+    /* the next piece overwrites the current one */
+
+    lg->size = 0;
+
+    if (carry)
+    {
+        ((dbtext *) lg->buffer)[0] = (dbtext) carry;
+
+        lg->size = (ub4) sizeof(dbtext);
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_FetchPieces
  * --------------------------------------------------------------------------------------------- */
@@ -306,23 +448,30 @@ boolean OCI_FetchPieces
     ub1 in_out;
     ub4 i, j;
 
+    OCI_Define *def     = NULL;
+    OCI_Long   *pending = NULL;
+    ub4         row     = 0;
+    boolean     stream  = FALSE;
+
     OCI_CALL_DECLARE_CONTEXT(TRUE)
 
     OCI_CHECK(NULL == rs, FALSE)
 
     OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt);
 
+    stream = (NULL != rs->stmt->long_handler);
+
     /* reset long objects */
 
     for (i = 0; i < rs->nb_defs; i++)
     {
-        OCI_Define *def = &rs->defs[i];
+        OCI_Define *cur = &rs->defs[i];
 
-        if (OCI_CDT_LONG == def->col.datatype)
+        if (OCI_CDT_LONG == cur->col.datatype)
         {
-            for (j = 0; j < def->buf.count; j++)
+            for (j = 0; j < cur->buf.count; j++)
             {
-                def->buf.data[j] = OCI_LongInit(rs->stmt, (OCI_Long *)def->buf.data[j], def, def->col.subtype);
+                cur->buf.data[j] = OCI_LongInit(rs->stmt, (OCI_Long *)cur->buf.data[j], cur, cur->col.subtype);
             }
         }
     }
@@ -331,91 +480,116 @@ boolean OCI_FetchPieces
 
     while (OCI_STATUS && (OCI_NEED_DATA == rs->fetch_status))
     {
-        ub1   piece  = OCI_NEXT_PIECE;
-        ub4   iter   = 0;
-        void *handle = NULL;
+        ub1       piece  = OCI_NEXT_PIECE;
+        ub4       iter   = 0;
+        void     *handle = NULL;
+        OCI_Long *lg     = NULL;
 
         /* get piece information */
 
         OCI_EXEC(OCIStmtGetPieceInfo(rs->stmt->stmt, rs->stmt->con->err, &handle,  &type, &in_out, &iter, &dx, &piece))
 
-        /* search for the given column */
+        /* search for the given column. Pieces of a same value are requested one after
+           the other, so the define of the previous piece is checked first */
 
-        for (i = 0; OCI_STATUS && (i < rs->nb_defs); i++)
+        if (OCI_STATUS && (!def || (def->buf.handle != handle)))
         {
-            OCI_Define *def = &(rs->defs[i]);
+            def = NULL;
 
-            if ((OCI_CDT_LONG == def->col.datatype) && (def->buf.handle == handle))
+            for (i = 0; i < rs->nb_defs; i++)
             {
-                /* get the long object for the given internal row */
+                OCI_Define *cur = &(rs->defs[i]);
 
-                OCI_Long *lg = (OCI_Long *) def->buf.data[iter];
+                if ((OCI_CDT_LONG == cur->col.datatype) && (cur->buf.handle == handle))
+                {
+                    def = cur;
+                    break;
+                }
+            }
+        }
 
-                unsigned int nb_alloc      = 0;
-                unsigned int trailing_size = 0;
-                unsigned int char_fact     = sizeof(otext) / sizeof(dbtext);
+        if (OCI_STATUS && def)
+        {
+            /* get the long object for the given internal row */
 
-                /* setup up piece size */
+            lg = (OCI_Long *) def->buf.data[iter];
 
-                ub4 bufsize = rs->stmt->long_size;
+            /* in streaming mode, the previous piece is handed to the user callback
+               before its buffer is reused */
 
-                if (char_fact == 0)
-                {
-                    char_fact = 1;
-                }
+            if (pending)
+            {
+                OCI_FetchPieceDeliver(rs, pending->def, pending, row, (boolean) (lg != pending));
 
-                if (OCI_CLONG == lg->type)
-                {
-                    bufsize += (ub4) sizeof(dbtext);
-                }
+                pending = NULL;
+            }
+        }
 
-                nb_alloc = (lg->maxsize / bufsize);
+        if (OCI_STATUS && lg)
+        {
+            ub4 needed = 0;
 
-                if (OCI_CLONG == lg->type)
-                {
-                    trailing_size = sizeof(dbtext) * nb_alloc;
-                }
+            /* setup up piece size */
 
-                /* check buffer */
+            ub4 bufsize = rs->stmt->long_size;
 
-                if (!lg->buffer)
-                {
-                    lg->maxsize = bufsize;
+            if (OCI_CLONG == lg->type)
+            {
+                bufsize += (ub4) sizeof(dbtext);
+            }
 
-                    OCI_ALLOCATE_DATA(OCI_IPC_LONG_BUFFER, lg->buffer, lg->maxsize)
-                }
-                else if ((lg->size*char_fact) >= (lg->maxsize - trailing_size))
-                {
-                    lg->maxsize = (lg->size + trailing_size + bufsize) * char_fact;
+            lg->piecesize = bufsize;
 
-                    lg->buffer = (ub1 *) OCI_MemRealloc(lg->buffer, (size_t) OCI_IPC_LONG_BUFFER, (size_t) lg->maxsize, 1, TRUE);
-                }
+            if (OCI_CLONG == lg->type)
+            {
+                lg->piecesize /= sizeof(otext);
+                lg->piecesize *= sizeof(dbtext);
+                lg->piecesize -= (ub4) sizeof(dbtext);
 
-                /* update piece info */
+                /* in streaming mode, the buffer may start with a carried character */
 
-                if (OCI_STATUS)
+                if (stream)
                 {
-                    lg->piecesize = bufsize;
+                    lg->piecesize -= lg->size;
+                }
+            }
 
-                    if (OCI_CLONG == lg->type)
-                    {
-                        lg->piecesize /= sizeof(otext);
-                        lg->piecesize *= sizeof(dbtext);
-                        lg->piecesize -= (ub4) sizeof(dbtext);
-                    }
+            /* check buffer: strings need room for their expansion to otext and for the zero
+               terminal character. The buffer grows geometrically to limit reallocations */
 
-                    OCI_EXEC
-                    (
-                        OCIStmtSetPieceInfo((dvoid *) handle,
-                                            (ub4) OCI_HTYPE_DEFINE,
-                                            lg->stmt->con->err,
-                                            (dvoid *) (lg->buffer + (size_t) lg->size),
-                                            &lg->piecesize, piece,
-                                            lg->def->buf.inds, (ub2 *) NULL)
-                    )
-                }
+            needed = lg->size + lg->piecesize;
 
-                break;
+            if (OCI_CLONG == lg->type)
+            {
+                needed = (needed / (ub4) sizeof(dbtext) + 1) * (ub4) sizeof(otext);
+            }
+
+            if (!lg->buffer)
+            {
+                lg->maxsize = (needed > bufsize) ? needed : bufsize;
+
+                OCI_ALLOCATE_DATA(OCI_IPC_LONG_BUFFER, lg->buffer, lg->maxsize)
+            }
+            else if (needed > lg->maxsize)
+            {
+                lg->maxsize = (needed > lg->maxsize * 2) ? needed : lg->maxsize * 2;
+
+                lg->buffer = (ub1 *) OCI_MemRealloc(lg->buffer, (size_t) OCI_IPC_LONG_BUFFER, (size_t) lg->maxsize, 1, TRUE);
+            }
+
+            /* update piece info */
+
+            if (OCI_STATUS)
+            {
+                OCI_EXEC
+                (
+                    OCIStmtSetPieceInfo((dvoid *) handle,
+                                        (ub4) OCI_HTYPE_DEFINE,
+                                        lg->stmt->con->err,
+                                        (dvoid *) (lg->buffer + (size_t) lg->size),
+                                        &lg->piecesize, piece,
+                                        lg->def->buf.inds, (ub2 *) NULL)
+                )
             }
         }
 
@@ -451,49 +625,48 @@ boolean OCI_FetchPieces
             OCI_ExceptionOCI(rs->stmt->con->err, rs->stmt->con, rs->stmt, TRUE);
             OCI_STATUS = TRUE;
         }
-        else
+        else if (lg)
         {
-            /* search for the given column */
+            lg->size += lg->piecesize;
 
-            for (i = 0; i < rs->nb_defs; i++)
+            if (stream)
             {
-                OCI_Define *def = &rs->defs[i];
-
-                if ((OCI_CDT_LONG == def->col.datatype) && (def->buf.handle == handle))
-                {
-                    /* get the long object for the given internal row */
-
-                    OCI_Long *lg = (OCI_Long *) def->buf.data[iter];
-
-                    lg->size += lg->piecesize;
-
-                    break;
-                }
+                pending = lg;
+                row     = iter;
             }
         }
     }
 
+    /* deliver the last piece in streaming mode */
+
+    if (OCI_STATUS && pending)
+    {
+        OCI_FetchPieceDeliver(rs, pending->def, pending, row, TRUE);
+    }
+
     /* for LONG columns, set the zero terminal string */
 
-    for (i = 0; i < rs->nb_defs; i++)
+    for (i = 0; !stream && i < rs->nb_defs; i++)
     {
-        OCI_Define *def = &rs->defs[i];
+        OCI_Define *cur = &rs->defs[i];
 
-        if ((OCI_CDT_LONG == def->col.datatype) && (OCI_CLONG == def->col.subtype))
+        if ((OCI_CDT_LONG == cur->col.datatype) && (OCI_CLONG == cur->col.subtype))
         {
-            for (j = 0; j < def->buf.count; j++)
+            for (j = 0; j < cur->buf.count; j++)
             {
-                OCI_Long *lg = (OCI_Long *) def->buf.data[j];
+                OCI_Long *lgc = (OCI_Long *) cur->buf.data[j];
 
-                if (lg->buffer)
+                if (lgc->buffer)
                 {
-                    const int len  = (int) ( lg->size / sizeof(dbtext) );
+                    const int len  = (int) ( lgc->size / sizeof(dbtext) );
 
-                    ((dbtext *)lg->buffer)[len] = 0;
+                    ((dbtext *)lgc->buffer)[len] = 0;
 
                     if (OCILib.use_wide_char_conv)
                     {
-                        OCI_StringUTF16ToUTF32(lg->buffer, lg->buffer, len);
+                        /* keep the size in line with the characters left after combining surrogate pairs */
+
+                        lgc->size = (ub4) (OCI_StringUTF16ToUTF32(lgc->buffer, lgc->buffer, len) * sizeof(dbtext));
                     }
                 }
             }
@@ -532,138 +705,961 @@ boolean OCI_ClearFetchedObjectInstances(OCI_Resultset *rs)
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OCI_FetchData
+ * OCI_FetchSizeAdjust
  * --------------------------------------------------------------------------------------------- */
 
-boolean OCI_FetchData
+boolean OCI_FetchSizeAdjust
 (
-    OCI_Resultset *rs,
-    int            mode,
-    int            offset,
-    boolean       *success
+    OCI_Resultset *rs
 )
 {
-    OCI_CALL_DECLARE_CONTEXT(TRUE)
-
-    OCI_CHECK(NULL == rs, FALSE)
-
-    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt);
+    OCI_Statement *stmt  = rs->stmt;
+    ub4            size  = 0;
+    ub4            rows  = 0;
+    boolean        plain = TRUE;
+    ub4            i;
 
-    /* let's initialize the success flag to FALSE until the process completes */
-
-    *success = FALSE;
-
-    OCI_ClearFetchedObjectInstances(rs);
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
 
-    /* internal fetch */
+    OCI_CHECK(OCI_SFM_SCROLLABLE == stmt->exec_mode, TRUE)
 
- #if defined(OCI_STMT_SCROLLABLE_READONLY)
+    /* compute the memory needed per row */
 
-    if (OCILib.use_scrollable_cursors)
+    for (i = 0; i < rs->nb_defs; i++)
     {
-        rs->fetch_status = OCIStmtFetch2(rs->stmt->stmt, rs->stmt->con->err,
-                                         rs->fetch_size, (ub2) mode, (sb4) offset,
-                                         (ub4) OCI_DEFAULT);
+        size  += OCI_DefineGetRowSize(&rs->defs[i]);
+        plain  = plain && OCI_DefineIsPlainBuffer(&rs->defs[i]);
     }
-    else
 
-#endif
+    rows = (size > 0) ? (stmt->fetch_mem / size) : OCI_FETCH_SIZE_MAX;
 
-    {
-        rs->fetch_status = OCIStmtFetch(rs->stmt->stmt, rs->stmt->con->err,
-                                        rs->fetch_size, (ub2) OCI_FETCH_NEXT,
-                                        (ub4) OCI_DEFAULT);
-    }
+    rs->fetch_size_max = (rows < 1) ? 1 : ((rows > OCI_FETCH_SIZE_MAX) ? OCI_FETCH_SIZE_MAX : rows);
 
+    /* start with the statement fetch size and grow while rows keep coming when buffers can be
+       reallocated between fetches. Otherwise, use the budget right away */
 
-    if (OCI_ERROR == rs->fetch_status)
+    if (plain && !stmt->fetch_pipelined && (stmt->fetch_size < rs->fetch_size_max))
     {
-        /* failure */
-        OCI_ExceptionOCI(rs->stmt->con->err, rs->stmt->con, rs->stmt, FALSE);
-        OCI_STATUS = FALSE;
+        rs->fetch_size = stmt->fetch_size;
     }
-    else if (OCI_SUCCESS_WITH_INFO == rs->fetch_status)
+    else
     {
-        OCI_ExceptionOCI(rs->stmt->con->err, rs->stmt->con, rs->stmt, TRUE);
-        OCI_STATUS = TRUE;
+        rs->fetch_size = rs->fetch_size_max;
     }
-    else if (OCI_NEED_DATA == rs->fetch_status)
+
+    for (i = 0; i < rs->nb_defs; i++)
     {
-        /* need to do a piecewise fetch */
-        OCI_STATUS = OCI_FetchPieces(rs);
+        rs->defs[i].buf.count = rs->fetch_size;
     }
 
-    /* check string buffer for Unicode builds that need buffer expansion */
+    /* let OCI prefetch up to the budget as well on next executions unless the prefetch size was
+       changed by the application */
 
-    if (OCILib.use_wide_char_conv)
+    if (OCI_PREFETCH_SIZE == stmt->prefetch_size)
     {
-        OCI_ResultsetExpandStrings(rs);
+        OCI_SET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_PREFETCH_ROWS, stmt->stmt, &rs->fetch_size_max, sizeof(rs->fetch_size_max))
     }
 
-    /* check for success */
+    return OCI_STATUS;
+}
 
-    OCI_STATUS = (OCI_STATUS && ((OCI_SUCCESS           == rs->fetch_status) ||
-                                 (OCI_NO_DATA           == rs->fetch_status) ||
-                                 (OCI_SUCCESS_WITH_INFO == rs->fetch_status)));
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchSizeGrow
+ * --------------------------------------------------------------------------------------------- */
 
-    /* update internal fetch status and variables */
+boolean OCI_FetchSizeGrow
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 size = rs->fetch_size * 2;
+    ub4 i;
 
-    if (OCI_STATUS)
-    {
-        ub4 row_count   = 0;
-        ub4 row_fetched = 0;
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
-    #if defined(OCI_STMT_SCROLLABLE_READONLY)
+    /* size arrays for the number of rows fetched so far */
 
-        if (OCI_SFM_SCROLLABLE == rs->stmt->exec_mode)
-        {
-            OCI_GET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_CURRENT_POSITION, rs->stmt->stmt, &row_count, NULL)
-            OCI_GET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_ROWS_FETCHED, rs->stmt->stmt, &row_fetched, NULL)
-        }
-        else
+    while ((size < rs->row_count) && (size < rs->fetch_size_max))
+    {
+        size *= 2;
+    }
 
-    #endif
+    if (size > rs->fetch_size_max)
+    {
+        size = rs->fetch_size_max;
+    }
 
-        {
-            row_count   = OCI_GetAffectedRows(rs->stmt);
-            row_fetched = row_count - rs->row_count;
-        }
+    /* current rows are consumed, buffers can be replaced by larger ones */
 
-        if (rs->row_count < row_count)
-        {
-            rs->row_count = row_count;
-        }
+    for (i = 0; (i < rs->nb_defs) && OCI_STATUS; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
 
-        if (row_fetched > 0)
-        {
-            rs->row_fetched = row_fetched;
-        }
+        OCI_FREE(def->buf.data)
+        OCI_FREE(def->buf.inds)
+        OCI_FREE(def->buf.lens)
+        OCI_FREE(def->expanded)
 
-        /* so far, no OCI error occurred, let's clear the error flag */
+        def->buf.count = size;
 
-        *success = TRUE;
+        OCI_STATUS = OCI_DefineAlloc(def) && OCI_DefineDef(def, i + 1);
 
-        /* check if internal fetch was successful */
+        /* handles returned for previous rows must not reference the released buffers */
 
-        if ((OCI_NO_DATA == rs->fetch_status) && (row_fetched == 0))
+        if (OCI_STATUS && def->obj)
         {
-            if ((OCI_SFD_NEXT == mode) || (offset > 0))
+            if ((OCI_CDT_NUMERIC == def->col.datatype) && (OCI_OBJECT_FETCHED_CLEAN == ((OCI_Number *) def->obj)->hstate))
             {
-                rs->eof = TRUE;
+                ((OCI_Number *) def->obj)->handle = (OCINumber *) def->buf.data;
             }
-
-            if (offset < 0)
+            else if ((OCI_CDT_DATETIME == def->col.datatype) && !((OCI_Date *) def->obj)->allocated)
             {
-                rs->bof = TRUE;
+                ((OCI_Date *) def->obj)->handle = (OCIDate *) def->buf.data;
             }
-
-            OCI_STATUS = FALSE;
         }
     }
 
+    if (OCI_STATUS)
+    {
+        rs->fetch_size = size;
+    }
+
     return OCI_STATUS;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPipelineCreate
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchPipelineCreate
+(
+    OCI_Resultset *rs
+)
+{
+    OCI_FetchPipeline *pipe = NULL;
+    ub4 i;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    /* background fetches require a thread safe environment and forward only cursors */
+
+    OCI_CHECK(!OCI_LIB_THREADED, TRUE)
+    OCI_CHECK(OCI_SFM_SCROLLABLE == rs->stmt->exec_mode, TRUE)
+    OCI_CHECK(rs->stmt->nb_rbinds > 0, TRUE)
+
+    /* only columns fetched into plain buffers can be double buffered */
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        if (!OCI_DefineIsPlainBuffer(&rs->defs[i]))
+        {
+            return TRUE;
+        }
+    }
+
+    OCI_ALLOCATE_DATA(OCI_IPC_ARRAY, rs->pipe, 1)
+
+    pipe = rs->pipe;
+
+    OCI_ALLOCATE_DATA(OCI_IPC_ARRAY, pipe->bufs, rs->nb_defs)
+
+    /* allocate the spare buffers by letting the define allocate a second set */
+
+    for (i = 0; (i < rs->nb_defs) && OCI_STATUS; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+        OCI_Buffer  buf = def->buf;
+
+        def->buf.data = NULL;
+        def->buf.inds = NULL;
+        def->buf.lens = NULL;
+
+        OCI_STATUS = OCI_DefineAlloc(def);
+
+        pipe->bufs[i].data = def->buf.data;
+        pipe->bufs[i].inds = def->buf.inds;
+        pipe->bufs[i].lens = def->buf.lens;
+
+        def->buf.data = buf.data;
+        def->buf.inds = buf.inds;
+        def->buf.lens = buf.lens;
+    }
+
+    if (OCI_STATUS)
+    {
+        OCI_STATUS = OCI_HandleAlloc((dvoid *) rs->stmt->con->env, (dvoid **) (void *) &pipe->err, OCI_HTYPE_ERROR);
+    }
+
+    if (OCI_STATUS)
+    {
+        pipe->thread = OCI_ThreadCreate();
+
+        OCI_STATUS = (NULL != pipe->thread);
+    }
+
+    if (!OCI_STATUS)
+    {
+        OCI_FetchPipelineFree(rs);
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPipelineFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchPipelineFree
+(
+    OCI_Resultset *rs
+)
+{
+    OCI_FetchPipeline *pipe = rs->pipe;
+
+    OCI_CHECK(NULL == pipe, TRUE)
+
+    /* wait for a pending fetch as it writes into the spare buffers */
+
+    OCI_FetchPipelineWait(rs);
+
+    if (pipe->thread)
+    {
+        OCI_ThreadFree(pipe->thread);
+    }
+
+    if (pipe->err)
+    {
+        OCI_HandleFree(pipe->err, OCI_HTYPE_ERROR);
+    }
+
+    if (pipe->bufs)
+    {
+        for (ub4 i = 0; i < rs->nb_defs; i++)
+        {
+            OCI_FREE(pipe->bufs[i].data)
+            OCI_FREE(pipe->bufs[i].inds)
+            OCI_FREE(pipe->bufs[i].lens)
+        }
+
+        OCI_FREE(pipe->bufs)
+    }
+
+    OCI_FREE(rs->pipe)
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPipelineSwap
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_FetchPipelineSwap
+(
+    OCI_Resultset *rs
+)
+{
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Buffer *buf   = &rs->defs[i].buf;
+        OCI_Buffer *spare = &rs->pipe->bufs[i];
+
+        void   **data = buf->data;
+        OCIInd  *inds = buf->inds;
+        void    *lens = buf->lens;
+
+        buf->data = spare->data;
+        buf->inds = spare->inds;
+        buf->lens = spare->lens;
+
+        spare->data = data;
+        spare->inds = inds;
+        spare->lens = lens;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPipelineProc
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_FetchPipelineProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_Resultset *rs = (OCI_Resultset *) arg;
+
+    OCI_NOT_USED(thread)
+
+    rs->pipe->status = OCIStmtFetch(rs->stmt->stmt, rs->pipe->err, rs->fetch_size,
+                                    (ub2) OCI_FETCH_NEXT, (ub4) OCI_DEFAULT);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPipelineStart
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchPipelineStart
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 i;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    /* redefine the columns on the spare buffers while the current ones are being consumed */
+
+    OCI_FetchPipelineSwap(rs);
+
+    for (i = 0; (i < rs->nb_defs) && OCI_STATUS; i++)
+    {
+        OCI_STATUS = OCI_DefineDef(&rs->defs[i], i + 1);
+    }
+
+    OCI_FetchPipelineSwap(rs);
+
+    /* fetch the next array of rows in background */
+
+    if (OCI_STATUS)
+    {
+        rs->pipe->pending = TRUE;
+
+        OCI_STATUS = OCI_ThreadRun(rs->pipe->thread, OCI_FetchPipelineProc, rs);
+
+        rs->pipe->pending = OCI_STATUS;
+    }
+
+    /* on failure, go back to regular fetches into the current buffers */
+
+    if (!OCI_STATUS)
+    {
+        for (i = 0; i < rs->nb_defs; i++)
+        {
+            OCI_DefineDef(&rs->defs[i], i + 1);
+        }
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPipelineJoin
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchPipelineJoin
+(
+    OCI_Resultset *rs
+)
+{
+    OCI_FetchPipeline *pipe = rs->pipe;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    OCI_CHECK(NULL == pipe || !pipe->pending, TRUE)
+
+    /* the joined thread gets a new handle for the next background fetch */
+
+    OCI_STATUS = OCI_ThreadJoin(pipe->thread) && OCI_ThreadReset(pipe->thread);
+
+    pipe->pending = FALSE;
+    pipe->ready   = TRUE;
+
+    /* without a usable thread, next arrays of rows are fetched in the foreground */
+
+    pipe->stopped = !OCI_STATUS;
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchPipelineWait
+ * --------------------------------------------------------------------------------------------- */
+
+sword OCI_FetchPipelineWait
+(
+    OCI_Resultset *rs
+)
+{
+    OCI_FetchPipeline *pipe = rs->pipe;
+
+    OCI_CHECK(NULL == pipe, OCI_SUCCESS)
+
+    OCI_FetchPipelineJoin(rs);
+
+    OCI_CHECK(!pipe->ready, OCI_SUCCESS)
+
+    pipe->ready = FALSE;
+
+    /* the spare buffers now hold the rows to consume */
+
+    OCI_FetchPipelineSwap(rs);
+
+    return pipe->status;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchData
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchData
+(
+    OCI_Resultset *rs,
+    int            mode,
+    int            offset,
+    boolean       *success
+)
+{
+    OCIError *err = NULL;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    err = rs->stmt->con->err;
+
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt);
+
+    /* let's initialize the success flag to FALSE until the process completes */
+
+    *success = FALSE;
+
+    OCI_ClearFetchedObjectInstances(rs);
+
+    /* in adaptive mode, grow arrays of rows when the previous fetch filled the current one */
+
+    if ((rs->fetch_size < rs->fetch_size_max) && (OCI_SUCCESS == rs->fetch_status) &&
+        (rs->row_fetched == rs->fetch_size) && !rs->pipe)
+    {
+        OCI_STATUS = OCI_FetchSizeGrow(rs);
+
+        OCI_CHECK(!OCI_STATUS, FALSE)
+    }
+
+    /* internal fetch */
+
+    if (rs->pipe && (rs->pipe->pending || rs->pipe->ready))
+    {
+        /* rows were already fetched in background */
+
+        err = rs->pipe->err;
+
+        rs->fetch_status = OCI_FetchPipelineWait(rs);
+    }
+    else
+
+ #if defined(OCI_STMT_SCROLLABLE_READONLY)
+
+    if (OCILib.use_scrollable_cursors)
+    {
+        rs->fetch_status = OCIStmtFetch2(rs->stmt->stmt, rs->stmt->con->err,
+                                         rs->fetch_size, (ub2) mode, (sb4) offset,
+                                         (ub4) OCI_DEFAULT);
+    }
+    else
+
+#endif
+
+    {
+        rs->fetch_status = OCIStmtFetch(rs->stmt->stmt, rs->stmt->con->err,
+                                        rs->fetch_size, (ub2) OCI_FETCH_NEXT,
+                                        (ub4) OCI_DEFAULT);
+    }
+
+
+    if (OCI_ERROR == rs->fetch_status)
+    {
+        /* failure */
+        OCI_ExceptionOCI(err, rs->stmt->con, rs->stmt, FALSE);
+        OCI_STATUS = FALSE;
+    }
+    else if (OCI_SUCCESS_WITH_INFO == rs->fetch_status)
+    {
+        OCI_ExceptionOCI(err, rs->stmt->con, rs->stmt, TRUE);
+        OCI_STATUS = TRUE;
+    }
+    else if (OCI_NEED_DATA == rs->fetch_status)
+    {
+        /* need to do a piecewise fetch */
+        OCI_STATUS = OCI_FetchPieces(rs);
+    }
+
+    /* flag string buffers for Unicode builds that need buffer expansion */
+
+    if (OCILib.use_wide_char_conv)
+    {
+        OCI_ResultsetResetStrings(rs);
+    }
+
+    /* check for success */
+
+    OCI_STATUS = (OCI_STATUS && ((OCI_SUCCESS           == rs->fetch_status) ||
+                                 (OCI_NO_DATA           == rs->fetch_status) ||
+                                 (OCI_SUCCESS_WITH_INFO == rs->fetch_status)));
+
+    /* update internal fetch status and variables */
+
+    if (OCI_STATUS)
+    {
+        ub4 row_count   = 0;
+        ub4 row_fetched = 0;
+
+    #if defined(OCI_STMT_SCROLLABLE_READONLY)
+
+        if (OCI_SFM_SCROLLABLE == rs->stmt->exec_mode)
+        {
+            OCI_GET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_CURRENT_POSITION, rs->stmt->stmt, &row_count, NULL)
+            OCI_GET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_ROWS_FETCHED, rs->stmt->stmt, &row_fetched, NULL)
+        }
+        else
+
+    #endif
+
+        {
+            row_count   = OCI_GetAffectedRows(rs->stmt);
+            row_fetched = row_count - rs->row_count;
+        }
+
+        if (rs->row_count < row_count)
+        {
+            rs->row_count = row_count;
+        }
+
+        if (row_fetched > 0)
+        {
+            rs->row_fetched = row_fetched;
+        }
+
+        /* so far, no OCI error occurred, let's clear the error flag */
+
+        *success = TRUE;
+
+        /* check if internal fetch was successful */
+
+        if ((OCI_NO_DATA == rs->fetch_status) && (row_fetched == 0))
+        {
+            if ((OCI_SFD_NEXT == mode) || (offset > 0))
+            {
+                rs->eof = TRUE;
+            }
+
+            if (offset < 0)
+            {
+                rs->bof = TRUE;
+            }
+
+            OCI_STATUS = FALSE;
+        }
+        else if (rs->pipe && !rs->pipe->stopped && (OCI_NO_DATA != rs->fetch_status))
+        {
+            /* start fetching the next array while this one is consumed */
+
+            OCI_FetchPipelineStart(rs);
+        }
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheCreate
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchCacheCreate
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 i;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    /* arrays of rows can only be served again for scrollable cursors */
+
+    OCI_CHECK(OCI_SFM_SCROLLABLE != rs->stmt->exec_mode, TRUE)
+    OCI_CHECK(rs->stmt->nb_rbinds > 0, TRUE)
+
+    /* only columns fetched into plain buffers can be copied */
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        if (!OCI_DefineIsPlainBuffer(&rs->defs[i]))
+        {
+            return TRUE;
+        }
+    }
+
+    OCI_ALLOCATE_DATA(OCI_IPC_ARRAY, rs->cache, 1)
+
+    if (OCI_STATUS)
+    {
+        rs->cache->max_rows = rs->stmt->fetch_cache_rows;
+        rs->cache->max_size = (size_t) rs->stmt->fetch_cache_mem;
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchCacheFree
+(
+    OCI_Resultset *rs
+)
+{
+    OCI_CHECK(NULL == rs->cache, TRUE)
+
+    OCI_FetchCacheClear(rs->cache);
+
+    OCI_FREE(rs->cache)
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheClear
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_FetchCacheClear
+(
+    OCI_FetchCache *cache
+)
+{
+    OCI_FetchWindow *win = cache->head;
+
+    while (win)
+    {
+        OCI_FetchWindow *next = win->next;
+
+        OCI_FREE(win->data)
+        OCI_FREE(win)
+
+        win = next;
+    }
+
+    cache->head = NULL;
+    cache->tail = NULL;
+    cache->rows = 0;
+    cache->size = 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheUnlink
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_FetchCacheUnlink
+(
+    OCI_FetchCache  *cache,
+    OCI_FetchWindow *win
+)
+{
+    if (win->prev)
+    {
+        win->prev->next = win->next;
+    }
+    else
+    {
+        cache->head = win->next;
+    }
+
+    if (win->next)
+    {
+        win->next->prev = win->prev;
+    }
+    else
+    {
+        cache->tail = win->prev;
+    }
+
+    win->prev = win->next = NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheLink
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_FetchCacheLink
+(
+    OCI_FetchCache  *cache,
+    OCI_FetchWindow *win
+)
+{
+    win->prev = NULL;
+    win->next = cache->head;
+
+    if (cache->head)
+    {
+        cache->head->prev = win;
+    }
+    else
+    {
+        cache->tail = win;
+    }
+
+    cache->head = win;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheStore
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchCacheStore
+(
+    OCI_Resultset *rs,
+    ub4            first
+)
+{
+    OCI_FetchCache  *cache = rs->cache;
+    OCI_FetchWindow *win   = NULL;
+    const ub4        count = rs->row_fetched;
+    size_t           size  = 0;
+    ub4              i;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    OCI_CHECK(NULL == cache || 0 == count, TRUE)
+
+    /* remember the end of the resultset once reached */
+
+    if (OCI_NO_DATA == rs->fetch_status)
+    {
+        cache->row_last = first + count - 1;
+    }
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        size += (size_t) count * (def->col.bufsize + sizeof(OCIInd) + (size_t) def->buf.sizelen);
+    }
+
+    /* arrays of rows exceeding the cache limits on their own are not kept */
+
+    OCI_CHECK((cache->max_rows > 0) && (count > cache->max_rows), TRUE)
+    OCI_CHECK((cache->max_size > 0) && (size > cache->max_size), TRUE)
+
+    /* replace a previous copy of the same rows and evict the least recently used ones */
+
+    for (win = cache->head; win; win = win->next)
+    {
+        if (win->first == first)
+        {
+            break;
+        }
+    }
+
+    while (win || (cache->tail && (((cache->max_rows > 0) && (cache->rows + count > cache->max_rows)) ||
+                                   ((cache->max_size > 0) && (cache->size + size > cache->max_size)))))
+    {
+        if (!win)
+        {
+            win = cache->tail;
+        }
+
+        OCI_FetchCacheUnlink(cache, win);
+
+        cache->rows -= win->count;
+        cache->size -= win->size;
+
+        OCI_FREE(win->data)
+        OCI_FREE(win)
+    }
+
+    /* copy the rows */
+
+    OCI_ALLOCATE_DATA(OCI_IPC_ARRAY, win, 1)
+    OCI_ALLOCATE_BUFFER(OCI_IPC_BUFF_ARRAY, win->data, size, 1)
+
+    if (OCI_STATUS)
+    {
+        ub1 *ptr = win->data;
+
+        for (i = 0; i < rs->nb_defs; i++)
+        {
+            OCI_Define *def = &rs->defs[i];
+
+            memcpy(ptr, def->buf.data, (size_t) count * def->col.bufsize);
+            ptr += (size_t) count * def->col.bufsize;
+
+            memcpy(ptr, def->buf.inds, (size_t) count * sizeof(OCIInd));
+            ptr += (size_t) count * sizeof(OCIInd);
+
+            memcpy(ptr, def->buf.lens, (size_t) count * (size_t) def->buf.sizelen);
+            ptr += (size_t) count * (size_t) def->buf.sizelen;
+        }
+
+        win->first  = first;
+        win->count  = count;
+        win->status = rs->fetch_status;
+        win->size   = size;
+
+        OCI_FetchCacheLink(cache, win);
+
+        cache->rows += count;
+        cache->size += size;
+    }
+    else if (win)
+    {
+        OCI_FREE(win)
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheLoad
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchCacheLoad
+(
+    OCI_Resultset *rs,
+    ub4            row
+)
+{
+    OCI_FetchCache  *cache = rs->cache;
+    OCI_FetchWindow *win   = NULL;
+    ub1             *ptr   = NULL;
+    ub4              i;
+
+    for (win = cache->head; win; win = win->next)
+    {
+        if ((row >= win->first) && (row - win->first < win->count))
+        {
+            break;
+        }
+    }
+
+    OCI_CHECK(NULL == win, FALSE)
+
+    /* copy back the rows into the define buffers */
+
+    ptr = win->data;
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        memcpy(def->buf.data, ptr, (size_t) win->count * def->col.bufsize);
+        ptr += (size_t) win->count * def->col.bufsize;
+
+        memcpy(def->buf.inds, ptr, (size_t) win->count * sizeof(OCIInd));
+        ptr += (size_t) win->count * sizeof(OCIInd);
+
+        memcpy(def->buf.lens, ptr, (size_t) win->count * (size_t) def->buf.sizelen);
+        ptr += (size_t) win->count * (size_t) def->buf.sizelen;
+    }
+
+    if (OCILib.use_wide_char_conv)
+    {
+        OCI_ResultsetResetStrings(rs);
+    }
+
+    rs->row_fetched  = win->count;
+    rs->fetch_status = win->status;
+    rs->row_cur      = row - win->first + 1;
+    rs->row_abs      = row;
+
+    /* the window becomes the most recently used one */
+
+    OCI_FetchCacheUnlink(cache, win);
+    OCI_FetchCacheLink(cache, win);
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchCacheMove
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchCacheMove
+(
+    OCI_Resultset *rs,
+    ub4            row,
+    boolean        backward,
+    boolean       *success
+)
+{
+    const sword status = rs->fetch_status;
+    boolean     res    = TRUE;
+
+    *success = TRUE;
+
+    /* rows are fetched by absolute position, so that the server side position of the cursor
+       does not matter when arrays of rows are served from the cache */
+
+    if ((rs->cache->row_last > 0) && (row > rs->cache->row_last))
+    {
+        rs->eof = TRUE;
+
+        return FALSE;
+    }
+
+    if ((rs->row_cur > 0) && (row + rs->row_cur > rs->row_abs) && (row + rs->row_cur <= rs->row_abs + rs->row_fetched))
+    {
+        /* the row belongs to the current array of rows */
+
+        rs->row_cur = rs->row_cur + row - rs->row_abs;
+        rs->row_abs = row;
+    }
+    else if (!OCI_FetchCacheLoad(rs, row))
+    {
+        /* when moving backward, fetch the array of rows ending with the requested row */
+
+        ub4 first = row;
+
+        if (backward)
+        {
+            first = (row > rs->fetch_size) ? row - rs->fetch_size + 1 : 1;
+        }
+
+        res = OCI_FetchData(rs, OCI_SFD_ABSOLUTE, (int) first, success);
+
+        if (res)
+        {
+            /* the fetched rows remain valid but a cache that failed to keep them is dropped */
+
+            if (!OCI_FetchCacheStore(rs, first))
+            {
+                OCI_FetchCacheClear(rs->cache);
+
+                *success = FALSE;
+            }
+
+            rs->row_cur = row - first + 1;
+            rs->row_abs = row;
+        }
+        else if (*success)
+        {
+            /* no rows were fetched, the resultset ends before the requested position and the
+               current array of rows remains valid */
+
+            if ((first > 1) && ((0 == rs->cache->row_last) || (rs->cache->row_last >= first)))
+            {
+                rs->cache->row_last = first - 1;
+            }
+
+            rs->fetch_status = status;
+        }
+    }
+
+    if (res)
+    {
+        rs->bof = FALSE;
+        rs->eof = FALSE;
+    }
+
+    return res;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_FetchCustom
  * --------------------------------------------------------------------------------------------- */
@@ -688,6 +1684,18 @@ boolean OCI_FetchCustom
             {
                 res = FALSE;
             }
+            else if (rs->cache)
+            {
+                if ((offset < 0) && ((ub4) -offset >= rs->row_abs))
+                {
+                    rs->bof = TRUE;
+                    res     = FALSE;
+                }
+                else
+                {
+                    res = OCI_FetchCacheMove(rs, (ub4) ((int) rs->row_abs + offset), (boolean) (offset < 0), err);
+                }
+            }
             else
             {
                 const int offset_save = offset;
@@ -711,6 +1719,10 @@ boolean OCI_FetchCustom
             {
                 res = FALSE;
             }
+            else if (rs->cache && (offset > 0))
+            {
+                res = OCI_FetchCacheMove(rs, (ub4) offset, FALSE, err);
+            }
             else
             {
                 rs->row_abs = 1;
@@ -748,6 +1760,20 @@ boolean OCI_ResultsetInit
 OCI_Resultset *rs
 )
 {
+    boolean res = TRUE;
+
+    /* discard the rows fetched in background for the previous execution */
+
+    OCI_FetchPipelineWait(rs);
+    OCI_FetchPipelineFree(rs);
+
+    /* in adaptive mode, start with arrays of rows large enough for the previous execution */
+
+    if ((rs->fetch_size < rs->fetch_size_max) && (rs->row_count > rs->fetch_size))
+    {
+        res = OCI_FetchSizeGrow(rs);
+    }
+
     rs->bof          = TRUE;
     rs->eof          = FALSE;
     rs->fetch_status = OCI_SUCCESS;
@@ -756,7 +1782,37 @@ OCI_Resultset *rs
     rs->row_abs      = 0;
     rs->row_fetched  = 0;
 
-    return TRUE;
+    /* rows cached for the previous execution must not be served again and the cache
+       follows the current settings of the statement */
+
+    if (rs->cache)
+    {
+        OCI_FetchCacheClear(rs->cache);
+
+        rs->cache->row_last = 0;
+        rs->cache->max_rows = rs->stmt->fetch_cache_rows;
+        rs->cache->max_size = (size_t) rs->stmt->fetch_cache_mem;
+
+        if ((OCI_SFM_SCROLLABLE != rs->stmt->exec_mode) ||
+            ((0 == rs->cache->max_rows) && (0 == rs->cache->max_size)))
+        {
+            OCI_FetchCacheFree(rs);
+        }
+    }
+    else if (res && (rs->stmt->fetch_cache_rows > 0 || rs->stmt->fetch_cache_mem > 0))
+    {
+        res = OCI_FetchCacheCreate(rs);
+    }
+
+    /* apply the pipelined fetch setting of the new execution */
+
+    if (res && rs->stmt->fetch_pipelined && (rs->nb_defs > 0) &&
+        !(rs->stmt->exec_mode & OCI_DESCRIBE_ONLY) && !(rs->stmt->exec_mode & OCI_PARSE_ONLY))
+    {
+        res = OCI_FetchPipelineCreate(rs);
+    }
+
+    return res;
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -772,6 +1828,11 @@ OCI_Resultset *rs
 
     OCI_CHECK(NULL == rs, FALSE)
 
+    /* stop background fetches before releasing buffers */
+
+    OCI_FetchPipelineFree(rs);
+    OCI_FetchCacheFree(rs);
+
     for (ub4 i = 0; i < rs->nb_defs; i++)
     {
         OCI_Define *def = &(rs->defs[i]);
@@ -847,11 +1908,16 @@ OCI_Resultset *rs
         OCI_FREE(def->buf.obj_inds)
         OCI_FREE(def->buf.lens)
         OCI_FREE(def->buf.tmpbuf)
+        OCI_FREE(def->expanded)
     }
 
-    /* free column map */
+    /* free column map or give it back to the statement cache */
 
-    if (rs->map)
+    if (rs->map && rs->cols_cached && rs->stmt->cols_cache && !rs->stmt->cols_cache->map)
+    {
+        rs->stmt->cols_cache->map = rs->map;
+    }
+    else if (rs->map)
     {
         OCI_HashFree(rs->map);
     }
@@ -860,11 +1926,238 @@ OCI_Resultset *rs
 
     OCI_FREE(rs->defs)
 
+    OCI_FREE(rs->struct_members)
+
     OCI_FREE(rs)
 
     return TRUE;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StructLayoutCreate
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StructLayoutCreate
+(
+    OCI_Resultset *rs
+)
+{
+    size_t offset    = 0;
+    size_t align_max = 1;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+
+    OCI_CHECK(NULL == rs, FALSE)
+    OCI_CHECK(NULL != rs->struct_members, TRUE)
+
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    OCI_ALLOCATE_DATA(OCI_IPC_VOID, rs->struct_members, rs->nb_defs)
+
+    for (ub4 i = 0; OCI_STATUS && i < rs->nb_defs; i++)
+    {
+        OCI_Define       *def = &rs->defs[i];
+        OCI_StructMember *mbr = &rs->struct_members[i];
+
+        size_t align = 0;
+
+        if (OCI_CDT_NUMERIC == def->col.datatype)
+        {
+            /* user defined numeric type or big_int for numbers without native C type */
+
+            mbr->type = def->col.struct_subtype;
+
+            if (OCI_UNKNOWN == mbr->type)
+            {
+                mbr->type = (OCI_NUM_NUMBER == def->col.subtype) ? OCI_NUM_BIGINT : def->col.subtype;
+            }
+
+            mbr->mode = (mbr->type == def->col.subtype) ? OCI_SMM_COPY : OCI_SMM_NUMERIC;
+            mbr->size = OCI_GetNumericTypeSize(mbr->type);
+            align     = (OCI_NUM_NUMBER == mbr->type) ? 1 : mbr->size;
+        }
+        else
+        {
+            OCI_ColumnGetAttrInfo(&def->col, rs->nb_defs, i, &mbr->size, &align);
+
+            mbr->type = OCI_UNKNOWN;
+            mbr->mode = OCI_SMM_HANDLE;
+
+            if ((OCI_CDT_RAW == def->col.datatype) ||
+                ((OCI_CDT_TEXT == def->col.datatype) && (OCI_CLONG != def->col.subtype)))
+            {
+                mbr->mode = OCI_SMM_DATA;
+            }
+        }
+
+        if (align == 0)
+        {
+            align = 1;
+        }
+
+        mbr->offset = ROUNDUP(offset, align);
+
+        offset = mbr->offset + mbr->size;
+
+        if (align > align_max)
+        {
+            align_max = align;
+        }
+    }
+
+    rs->struct_size = ROUNDUP(offset, align_max);
+
+    if (!OCI_STATUS)
+    {
+        OCI_FREE(rs->struct_members)
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StructFill
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StructFill
+(
+    OCI_Resultset *rs,
+    ub4            row,
+    void          *row_struct,
+    boolean       *inds
+)
+{
+    boolean res = TRUE;
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define       *def = &rs->defs[i];
+        OCI_StructMember *mbr = &rs->struct_members[i];
+
+        char *ptr = ((char *) row_struct) + mbr->offset;
+        void *data = NULL;
+
+        /* rows outside of the array (no row fetched yet) are reported as null */
+
+        boolean is_not_null = (row < def->buf.count);
+
+        if (is_not_null)
+        {
+            const OCIInd ind = (SQLT_NTY == def->col.sqlcode) ? *(OCIInd *) def->buf.obj_inds[row] : def->buf.inds[row];
+
+            is_not_null = (OCI_IND_NULL != ind);
+        }
+
+        if (inds)
+        {
+            inds[i] = is_not_null;
+        }
+
+        if (!is_not_null)
+        {
+            memset(ptr, 0, mbr->size);
+            continue;
+        }
+
+        if (OCI_SMM_HANDLE != mbr->mode)
+        {
+            data = ((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * row);
+        }
+
+        switch (mbr->mode)
+        {
+            case OCI_SMM_COPY:
+            {
+                memcpy(ptr, data, mbr->size);
+                break;
+            }
+            case OCI_SMM_NUMERIC:
+            {
+                res = OCI_TranslateNumericValue(rs->stmt->con, data, def->col.subtype, ptr, mbr->type) && res;
+                break;
+            }
+            case OCI_SMM_DATA:
+            {
+                if (def->expanded)
+                {
+                    OCI_DefineExpandStrings(def, row, 1);
+                }
+
+                *((void **) ptr) = data;
+                break;
+            }
+            default:
+            {
+                /* handle based values are only retrieved for the current row */
+
+                memset(ptr, 0, mbr->size);
+
+                switch (def->col.datatype)
+                {
+                    case OCI_CDT_TEXT:
+                    {
+                        *((otext **) ptr) =  (otext * ) OCI_GetString(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_LONG:
+                    {
+                        *((OCI_Long **) ptr) = OCI_GetLong(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_DATETIME:
+                    {
+                        *((OCI_Date **) ptr) = OCI_GetDate(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_CURSOR:
+                    {
+                        *((OCI_Statement **) ptr) = OCI_GetStatement(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_LOB:
+                    {
+                        *((OCI_Lob **) ptr) = OCI_GetLob(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_FILE:
+                    {
+                        *((OCI_File **) ptr) = OCI_GetFile(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_TIMESTAMP:
+                    {
+                        *((OCI_Timestamp **) ptr) = OCI_GetTimestamp(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_INTERVAL:
+                    {
+                        *((OCI_Interval **) ptr) = OCI_GetInterval(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_OBJECT:
+                    {
+                        *((OCI_Object **) ptr) = OCI_GetObject(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_COLLECTION:
+                    {
+                        *((OCI_Coll **) ptr) = OCI_GetColl(rs, i + 1);
+                        break;
+                    }
+                    case OCI_CDT_REF:
+                    {
+                        *((OCI_Ref **) ptr) = OCI_GetRef(rs, i + 1);
+                        break;
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    return res;
+}
+
 /* ********************************************************************************************* *
  *                            PUBLIC FUNCTIONS
  * ********************************************************************************************* */
@@ -964,6 +2257,8 @@ boolean OCI_API OCI_FetchPrev
     OCI_CALL_CHECK_SCROLLABLE_CURSOR_ACTIVATED(rs->stmt)
     OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
+    OCI_RESET_BATCH(rs)
+
     if (!rs->bof)
     {
         OCI_RETVAL = TRUE;
@@ -974,6 +2269,10 @@ boolean OCI_API OCI_FetchPrev
             {
                 rs->bof = TRUE;
             }
+            else if (rs->cache)
+            {
+                OCI_RETVAL = OCI_FetchCacheMove(rs, rs->row_abs - 1, TRUE, &OCI_STATUS);
+            }
             else
             {
                 int offset = 0;
@@ -1034,6 +2333,8 @@ boolean OCI_API OCI_FetchNext
     OCI_CALL_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
     OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
+    OCI_RESET_BATCH(rs)
+
     if (!rs->eof)
     {
         OCI_RETVAL = TRUE;
@@ -1044,7 +2345,11 @@ boolean OCI_API OCI_FetchNext
 
             if (rs->row_cur == rs->row_fetched)
             {
-                if (OCI_NO_DATA == rs->fetch_status)
+                if (rs->cache)
+                {
+                    OCI_RETVAL = OCI_FetchCacheMove(rs, rs->row_abs + 1, FALSE, &OCI_STATUS);
+                }
+                else if (OCI_NO_DATA == rs->fetch_status)
                 {
                     rs->eof = TRUE;
                 }
@@ -1071,16 +2376,6 @@ boolean OCI_API OCI_FetchNext
         {
             /* for resultset from returning into clause */
 
-            if (rs->row_abs == 0)
-            {
-                /* check string buffer once for Unicode build */
-
-                if (OCILib.use_wide_char_conv)
-                {
-                    OCI_ResultsetExpandStrings(rs);
-                }
-            }
-
             if (rs->row_abs >= rs->row_count)
             {
                 rs->eof = TRUE;
@@ -1117,13 +2412,22 @@ boolean OCI_API OCI_FetchFirst
     OCI_CALL_CHECK_SCROLLABLE_CURSOR_ACTIVATED(rs->stmt)
     OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
+    OCI_RESET_BATCH(rs)
+
     rs->bof = FALSE;
     rs->eof = FALSE;
 
-    rs->row_abs = 1;
-    rs->row_cur = 1;
+    if (rs->cache)
+    {
+        OCI_RETVAL = OCI_FetchCacheMove(rs, 1, FALSE, &OCI_STATUS);
+    }
+    else
+    {
+        rs->row_abs = 1;
+        rs->row_cur = 1;
 
-    OCI_RETVAL = (OCI_FetchData(rs, OCI_SFD_FIRST, 0, &OCI_STATUS) && !rs->bof);
+        OCI_RETVAL = (OCI_FetchData(rs, OCI_SFD_FIRST, 0, &OCI_STATUS) && !rs->bof);
+    }
 
 #endif
 
@@ -1149,15 +2453,31 @@ boolean OCI_API OCI_FetchLast
     OCI_CALL_CHECK_SCROLLABLE_CURSOR_ACTIVATED(rs->stmt)
     OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
+    OCI_RESET_BATCH(rs)
+
     rs->bof = FALSE;
     rs->eof = FALSE;
 
-    rs->row_abs = 0;
-    rs->row_cur = 1;
+    if (rs->cache && (rs->cache->row_last > 0))
+    {
+        OCI_RETVAL = OCI_FetchCacheMove(rs, rs->cache->row_last, TRUE, &OCI_STATUS);
+    }
+    else
+    {
+        rs->row_abs = 0;
+        rs->row_cur = 1;
+
+        OCI_RETVAL = (OCI_FetchData(rs, OCI_SFD_LAST, 0, &OCI_STATUS) && !rs->eof);
 
-    OCI_RETVAL = (OCI_FetchData(rs, OCI_SFD_LAST, 0, &OCI_STATUS) && !rs->eof);
+        rs->row_abs = rs->row_count;
 
-    rs->row_abs = rs->row_count;
+        /* the position of the last row is now known */
+
+        if (OCI_RETVAL && rs->cache)
+        {
+            rs->cache->row_last = rs->row_count;
+        }
+    }
 
 #endif
 
@@ -1186,6 +2506,8 @@ boolean OCI_API OCI_FetchSeek
     OCI_CALL_CHECK_ENUM_VALUE(rs->stmt->con, rs->stmt, mode, SeekModeValues, OTEXT("Fetch Seek Mode"))
     OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
+    OCI_RESET_BATCH(rs)
+
     OCI_RETVAL = OCI_FetchCustom(rs, (int)mode, offset, &OCI_STATUS);
 
 #else
@@ -1314,6 +2636,34 @@ unsigned int OCI_API OCI_GetColumnIndex
     OCI_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_CheckColumnType
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_CheckColumnType
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int   type
+)
+{
+    unsigned int datatype = OCI_UNKNOWN;
+
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CALL_CHECK_BOUND(rs->stmt->con, index, 1, rs->nb_defs)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    datatype = rs->defs[index - 1].col.datatype;
+
+    OCI_CALL_CHECK_COMPAT(rs->stmt->con, (type == datatype) || (OCI_CDT_TEXT == type) ||
+                                         (OCI_CDT_NUMERIC == type && OCI_CDT_TEXT == datatype))
+
+    OCI_RETVAL = OCI_STATUS;
+
+    OCI_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_SetStructNumericType
  * --------------------------------------------------------------------------------------------- */
@@ -1333,6 +2683,10 @@ boolean OCI_API OCI_SetStructNumericType
 
     rs->defs[index-1].col.struct_subtype = (ub2) type;
 
+    /* the structure layout is computed again at next retrieval */
+
+    OCI_FREE(rs->struct_members)
+
     OCI_RETVAL = OCI_STATUS;
 
     OCI_CALL_EXIT()
@@ -1379,140 +2733,86 @@ boolean OCI_API OCI_GetStruct
     void          *row_struct_ind
 )
 {
-    char *ptr     = NULL;
-    boolean *inds = NULL;
-
     OCI_CALL_ENTER(boolean, FALSE)
     OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
     OCI_CALL_CHECK_PTR(OCI_IPC_VOID, row_struct)
     OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
-    ptr  = (char    *) row_struct;
-    inds = (boolean *) row_struct_ind;
+    /* the structure layout is computed once and reused for every row */
+
+    OCI_STATUS = OCI_StructLayoutCreate(rs);
 
-    if (ptr)
+    if (OCI_STATUS)
     {
-        size_t size1 = 0;
-        size_t size2 = 0;
-        size_t align = 0;
+        /* no current row maps to an out of range row, reported as null values */
 
-        size_t size = 0;
+        OCI_STATUS = OCI_StructFill(rs, rs->row_cur - 1, row_struct, (boolean *) row_struct_ind);
+    }
 
-        for (ub4 i = 1; i <= rs->nb_defs; i++)
-        {
-            OCI_Define *def = &rs->defs[i - 1];
+    OCI_RETVAL = OCI_STATUS;
 
-            const boolean is_not_null = OCI_DefineIsDataNotNull(def);
+    OCI_CALL_EXIT()
+}
 
-            if (i == 1)
-            {
-                OCI_ColumnGetAttrInfo(&def->col, rs->nb_defs, i - 1, &size1, &align);
-            }
-            else
-            {
-                size1 = size2;
-            }         
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetStructs
+ * --------------------------------------------------------------------------------------------- */
 
-            OCI_ColumnGetAttrInfo(&rs->defs[i].col, rs->nb_defs, i, &size2, &align);
+unsigned int OCI_API OCI_GetStructs
+(
+    OCI_Resultset *rs,
+    void          *row_structs,
+    void          *row_struct_inds,
+    unsigned int   count
+)
+{
+    boolean *inds = NULL;
+    char    *ptr  = NULL;
+    ub4      n    = 0;
 
-            size += size1;
+    OCI_CALL_ENTER(unsigned int, 0)
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CALL_CHECK_PTR(OCI_IPC_VOID, row_structs)
+    OCI_CALL_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
 
-            size = ROUNDUP(size, align);
-                
-            memset(ptr, 0, size1);
+    OCI_STATUS = OCI_StructLayoutCreate(rs);
 
-            if (is_not_null)
-            {
-                switch (def->col.datatype)
-                {
-                    case OCI_CDT_NUMERIC:
-                    {
-                        ub2 type = def->col.struct_subtype;
-                        if (type == OCI_UNKNOWN)
-                        {
-                            type = def->col.subtype;
-                        }
+    if (OCI_STATUS)
+    {
+        /* members returned as handles are bound to the current row and cannot be used here */
 
-                        OCI_DefineGetNumber(rs, i, ptr, type);
+        for (ub4 i = 0; i < rs->nb_defs; i++)
+        {
+            OCI_CALL_CHECK_COMPAT(rs->stmt->con, OCI_SMM_HANDLE != rs->struct_members[i].mode)
+        }
 
-                        break;
-                    }
-                    case OCI_CDT_TEXT:
-                    {
-                        *((otext **) ptr) =  (otext * ) OCI_GetString(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_RAW:
-                    {
-                        *((void **) ptr) = OCI_DefineGetData(def);
-                        break;
-                    }
-                    case OCI_CDT_LONG:
-                    {
-                        *((OCI_Long **) ptr) = OCI_GetLong(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_DATETIME:
-                    {
-                        *((OCI_Date **) ptr) = OCI_GetDate(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_CURSOR:
-                    {
-                        *((OCI_Statement **) ptr) = OCI_GetStatement(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_LOB:
-                    {
-                        *((OCI_Lob **) ptr) = OCI_GetLob(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_FILE:
-                    {
-                        *((OCI_File **) ptr) = OCI_GetFile(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_TIMESTAMP:
-                    {
-                        *((OCI_Timestamp **) ptr) = OCI_GetTimestamp(rs, i);
+        n    = min(count, rs->batch_count);
+        ptr  = (char    *) row_structs;
+        inds = (boolean *) row_struct_inds;
 
-                        break;
-                    }
-                    case OCI_CDT_INTERVAL:
-                    {
-                        *((OCI_Interval **) ptr) = OCI_GetInterval(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_OBJECT:
-                    {
-                        *((OCI_Object **) ptr) = OCI_GetObject(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_COLLECTION:
-                    {
-                        *((OCI_Coll **) ptr) = OCI_GetColl(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_REF:
-                    {
-                        *((OCI_Ref **) ptr) = OCI_GetRef(rs, i);
-                        break;
-                    }
-                }
+        for (ub4 i = 0; i < rs->nb_defs; i++)
+        {
+            if (rs->defs[i].expanded)
+            {
+                OCI_DefineExpandStrings(&rs->defs[i], rs->batch_offset, n);
             }
+        }
+
+        for (ub4 i = 0; OCI_STATUS && i < n; i++)
+        {
+            OCI_STATUS = OCI_StructFill(rs, rs->batch_offset + i, ptr, inds);
 
-            ptr = ((char *) row_struct) + size;
+            ptr += rs->struct_size;
 
             if (inds)
             {
-                *inds = is_not_null;
-
-                inds++;
+                inds += rs->nb_defs;
             }
         }
-    }
 
-    OCI_RETVAL = OCI_STATUS;
+        OCI_RETVAL = OCI_STATUS ? n : 0;
+    }
 
     OCI_CALL_EXIT()
 }
@@ -1741,9 +3041,7 @@ const otext * OCI_API OCI_GetString
 
             if (OCI_CLONG == def->col.subtype)
             {
-                ub2* lens = (ub2 *)def->buf.lens;
-
-                OCI_RETVAL[lens[rs->row_cur - 1]] = 0;
+                OCI_RETVAL[OCI_DefineGetLength(def, rs->row_cur - 1)] = 0;
             }
         }
         else if ((OCI_CDT_LONG == def->col.datatype) && (OCI_CLONG == def->col.subtype))
@@ -1787,7 +3085,7 @@ const otext * OCI_API OCI_GetString
             case OCI_CDT_RAW:
             {
                 data = OCI_DefineGetData(def);
-                data_size = ((ub2*)def->buf.lens)[def->rs->row_cur - 1];
+                data_size = OCI_DefineGetLength(def, def->rs->row_cur - 1);
                 break;
             }
             case OCI_CDT_REF:
@@ -1914,6 +3212,50 @@ const otext * OCI_API OCI_GetString
     OCI_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetStringWithLength
+ * --------------------------------------------------------------------------------------------- */
+
+const otext * OCI_API OCI_GetStringWithLength
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int  *length
+)
+{
+    OCI_Define *def = NULL;
+
+    OCI_CALL_ENTER(otext *, NULL)
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CALL_CHECK_PTR(OCI_IPC_VOID, length)
+    OCI_CALL_CHECK_BOUND(rs->stmt->con, index, 1, rs->nb_defs)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    *length = 0;
+
+    OCI_RETVAL = (otext *) OCI_GetString(rs, index);
+    OCI_STATUS = (NULL != OCI_RETVAL);
+
+    if (OCI_RETVAL)
+    {
+        def = OCI_GetDefine(rs, index);
+
+        if ((OCI_CDT_TEXT == def->col.datatype) && (OCI_CLONG != def->col.subtype))
+        {
+            /* the string lives in the define buffer and its length is known */
+
+            *length = (unsigned int) OCI_DefineGetLength(def, rs->row_cur - 1);
+            *length /= (unsigned int) (OCILib.use_wide_char_conv ? sizeof(dbtext) : sizeof(otext));
+        }
+        else
+        {
+            *length = (unsigned int) ostrlen(OCI_RETVAL);
+        }
+    }
+
+    OCI_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_GetString2
  * --------------------------------------------------------------------------------------------- */
@@ -1953,7 +3295,7 @@ unsigned int OCI_API OCI_GetRaw
 
     if (OCI_MATCHING_TYPE(def, OCI_CDT_RAW))
     {
-        unsigned int size = (unsigned int)(ub2)((ub2*)def->buf.lens)[def->rs->row_cur - 1];
+        unsigned int size = (unsigned int) OCI_DefineGetLength(def, def->rs->row_cur - 1);
 
         OCI_RETVAL = size < len ? size : len;
         OCI_STATUS = TRUE;
@@ -1997,7 +3339,7 @@ unsigned int OCI_API OCI_GetRaw2
 
         if (OCI_MATCHING_TYPE(def, OCI_CDT_RAW))
         {
-            unsigned int size = (unsigned int)(ub2)((ub2*)def->buf.lens)[def->rs->row_cur - 1];
+            unsigned int size = (unsigned int) OCI_DefineGetLength(def, def->rs->row_cur - 1);
 
             OCI_RETVAL = size < len ? size : len;
             OCI_STATUS = TRUE;
@@ -2406,15 +3748,22 @@ unsigned int OCI_API OCI_GetDataSize
 
     if (def && OCI_DefineIsDataNotNull(def))
     {
-        ub2* lens = (ub2 *)def->buf.lens;
-
-        if (lens)
+        if (def->buf.lens)
         {
-            OCI_RETVAL = lens[rs->row_cur - 1];
-
             if (OCI_CDT_TEXT == def->col.datatype)
             {
-                OCI_RETVAL /= sizeof(otext);
+                /* UTF16 strings are expanded on access, which sets their final length */
+
+                if (OCILib.use_wide_char_conv)
+                {
+                    OCI_DefineGetData(def);
+                }
+
+                OCI_RETVAL = OCI_DefineGetLength(def, rs->row_cur - 1) / (OCILib.use_wide_char_conv ? sizeof(dbtext) : sizeof(otext));
+            }
+            else
+            {
+                OCI_RETVAL = OCI_DefineGetLength(def, rs->row_cur - 1);
             }
         }
     }
@@ -2542,9 +3891,209 @@ unsigned int OCI_API OCI_GetDataLength
 
     if (def && (rs->row_cur > 0))
     {
-        OCI_RETVAL = (unsigned int)((ub2 *)def->buf.lens)[rs->row_cur - 1];
+        OCI_RETVAL = (unsigned int) OCI_DefineGetLength(def, rs->row_cur - 1);
         OCI_STATUS = TRUE;
     }
 
     OCI_CALL_EXIT()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchBatch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_FetchBatch
+(
+    OCI_Resultset *rs,
+    unsigned int  *rows
+)
+{
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CALL_CHECK_PTR(OCI_IPC_VOID, rows)
+    OCI_CALL_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(rs->stmt)
+
+    *rows = 0;
+
+    OCI_RESET_BATCH(rs)
+
+    if (!rs->eof)
+    {
+        ub4 row_last = 0;
+
+        OCI_RETVAL = TRUE;
+
+        if (rs->stmt->nb_rbinds == 0)
+        {
+            /* for regular resultsets, fetch a new array only once the current one is consumed */
+
+            if (rs->row_cur == rs->row_fetched)
+            {
+                if (rs->cache)
+                {
+                    /* the batch starts with the next row */
+
+                    OCI_RETVAL = OCI_FetchCacheMove(rs, rs->row_abs + 1, FALSE, &OCI_STATUS);
+
+                    if (OCI_RETVAL)
+                    {
+                        rs->row_cur--;
+                        rs->row_abs--;
+                    }
+                }
+                else if (OCI_NO_DATA == rs->fetch_status)
+                {
+                    rs->eof = TRUE;
+                }
+                else
+                {
+                    OCI_RETVAL = OCI_FetchData(rs, OCI_SFD_NEXT, 0, &OCI_STATUS);
+
+                    if (OCI_RETVAL)
+                    {
+                        rs->bof     = FALSE;
+                        rs->row_cur = 0;
+                    }
+                }
+            }
+
+            row_last = rs->row_fetched;
+        }
+        else
+        {
+            /* for resultset from returning into clause, all rows are already available */
+
+            if (rs->row_abs >= rs->row_count)
+            {
+                rs->eof = TRUE;
+            }
+
+            row_last = rs->row_count;
+        }
+
+        OCI_RETVAL = OCI_RETVAL && !rs->eof;
+
+        if (OCI_RETVAL)
+        {
+            /* the batch covers the remaining rows of the current array */
+
+            rs->batch_offset = rs->row_cur;
+            rs->batch_count  = row_last - rs->row_cur;
+
+            rs->row_abs += rs->batch_count;
+            rs->row_cur  = row_last;
+
+            *rows = rs->batch_count;
+        }
+    }
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetBatchData
+ * --------------------------------------------------------------------------------------------- */
+
+const void * OCI_API OCI_GetBatchData
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int  *stride
+)
+{
+    OCI_Define *def = NULL;
+
+    OCI_GET_BATCH(rs, index, const void *, NULL, def)
+
+    /* strings of the batch are expanded at once for Unicode builds */
+
+    if (def->expanded)
+    {
+        OCI_DefineExpandStrings(def, rs->batch_offset, rs->batch_count);
+    }
+
+    OCI_RETVAL = ((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * rs->batch_offset);
+
+    if (stride)
+    {
+        *stride = (unsigned int) def->col.bufsize;
+    }
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetBatchIndicators
+ * --------------------------------------------------------------------------------------------- */
+
+const short * OCI_API OCI_GetBatchIndicators
+(
+    OCI_Resultset *rs,
+    unsigned int   index
+)
+{
+    OCI_Define *def = NULL;
+
+    OCI_GET_BATCH(rs, index, const short *, NULL, def)
+
+    OCI_RETVAL = (const short *) (def->buf.inds + rs->batch_offset);
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetBatchLengths
+ * --------------------------------------------------------------------------------------------- */
+
+const unsigned short * OCI_API OCI_GetBatchLengths
+(
+    OCI_Resultset *rs,
+    unsigned int   index
+)
+{
+    OCI_Define *def = NULL;
+
+    OCI_GET_BATCH(rs, index, const unsigned short *, NULL, def)
+
+    /* resultsets from returning into clauses use ub4 lengths */
+
+    OCI_CALL_CHECK_COMPAT(rs->stmt->con, def->buf.sizelen == (int) sizeof(ub2))
+
+    OCI_RETVAL = ((const unsigned short *) def->buf.lens) + rs->batch_offset;
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetBatchNumbers
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetBatchNumbers
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    void          *values,
+    unsigned int   type
+)
+{
+    OCI_Define *def = NULL;
+
+    OCI_GET_BATCH(rs, index, unsigned int, 0, def)
+
+    OCI_CALL_CHECK_PTR(OCI_IPC_VOID, values)
+    OCI_CALL_CHECK_COMPAT(rs->stmt->con, OCI_CDT_NUMERIC == def->col.datatype)
+    OCI_CALL_CHECK_COMPAT(rs->stmt->con, OCI_GetNumericTypeSize(type) > 0)
+
+    OCI_STATUS = OCI_TranslateNumericArray(rs->stmt->con,
+                                           ((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * rs->batch_offset),
+                                           def->col.subtype, def->col.bufsize, def->buf.inds + rs->batch_offset,
+                                           values, type, rs->batch_count);
+
+    if (OCI_STATUS)
+    {
+        OCI_RETVAL = rs->batch_count;
+    }
+
+    OCI_CALL_EXIT()
+}
@@ -90,6 +90,10 @@ static unsigned int LongModeValues[]       = { OCI_LONG_EXPLICIT, OCI_LONG_IMPLI
 #define OCI_BIND_GET_HANDLE(s, t, i) (bnd->is_array ? ((t **) (s))[i] : (t *) (s))
 #define OCI_BIND_GET_BUFFER(d, t, i) ((t *)((d) + (i) * sizeof(t)))
 
+#define OCI_BIND_IS_BIGINT(bnd)                                                \
+    ((OCI_CDT_NUMERIC == (bnd)->type) && (SQLT_VNU == (bnd)->code) &&          \
+     (OCI_NUM_BIGINT & (bnd)->subtype))
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_BindGetInternalIndex
  * --------------------------------------------------------------------------------------------- */
@@ -105,28 +109,21 @@ int OCI_BindGetInternalIndex
 
     if (stmt->map)
     {
-        he = OCI_HashLookup(stmt->map, name, FALSE);
+        he = OCI_HashFind(stmt->map, name);
 
-        while (he)
+        if (he)
         {
-            /* no more entries or key matched => so we got it ! */
-
-            if (!he->next || ostrcasecmp(he->key, name) == 0)
-            {
-                /* in order to use the same map for user binds and
-                   register binds :
-                      - user binds are stored as positive values
-                      - registers binds are stored as negatives values
-                */
-
-                index = he->values->value.num;
+            /* in order to use the same map for user binds and
+               register binds :
+                  - user binds are stored as positive values
+                  - registers binds are stored as negatives values
+            */
 
-                if (index < 0)
-                {
-                    index = -index;
-                }
+            index = he->values->value.num;
 
-                break;
+            if (index < 0)
+            {
+                index = -index;
             }
         }
     }
@@ -384,7 +381,30 @@ boolean OCI_BindCheck
                 const size_t src_offset = index * max_chars * sizeof(otext);
                 const size_t dst_offset = index * max_chars * sizeof(dbtext);
 
-                OCI_StringUTF32ToUTF16(src + src_offset, dst + dst_offset, max_chars - 1);
+                const unsigned int *str = (const unsigned int *) (src + src_offset);
+                unsigned short     *buf = (unsigned short *) (dst + dst_offset);
+
+                int len   = 0;
+                int count = 0;
+                int done  = 0;
+
+                while ((len < max_chars - 1) && str[len])
+                {
+                    len++;
+                }
+
+                /* supplementary characters take 2 code units and may not fit in the bind buffer */
+
+                count = OCI_StringUTF32ToUTF16Count(str, buf, len, max_chars - 1, &done);
+
+                buf[count] = 0;
+
+                if (done < len)
+                {
+                    OCI_STATUS = FALSE;
+
+                    OCI_ExceptionArgInvalidValue(bnd->stmt->con, bnd->stmt, bnd->name, index + 1);
+                }
             }
         }
         // otherwise we have an ocilib handle based type
@@ -552,6 +572,13 @@ boolean OCI_BindCheckAll
             OCI_STATUS = OCI_STATUS && OCI_SetFetchSize(stmt, stmt->fetch_size);
         }
 
+        /* when binds are tracked, the ones not modified since the last execution are skipped */
+
+        if (stmt->bind_tracking && !bnd->dirty)
+        {
+            continue;
+        }
+
         if ((bnd->direction & OCI_BDM_IN) ||
             (bnd->alloc && 
              (OCI_CDT_DATETIME != bnd->type) &&
@@ -576,9 +603,19 @@ boolean OCI_BindCheckAll
                 {
                     const ub4 count = OCI_IS_PLSQL_STMT(stmt->type) ? bnd->nbelem : stmt->nb_iters;
 
-                    for (j = 0; j < count && OCI_STATUS; j++)
+                    if (OCI_BIND_IS_BIGINT(bnd) && bnd->input)
+                    {
+                        /* big_int arrays are encoded to OCINumber in a single pass */
+
+                        OCI_STATUS = OCI_TranslateNumericArray(stmt->con, bnd->input, bnd->subtype, sizeof(big_int),
+                                                               NULL, bnd->buffer.data, OCI_NUM_NUMBER, count);
+                    }
+                    else
                     {
-                        OCI_STATUS = OCI_BindCheck(bnd, (ub1*)bnd->input, (ub1*)bnd->buffer.data, j);
+                        for (j = 0; j < count && OCI_STATUS; j++)
+                        {
+                            OCI_STATUS = OCI_BindCheck(bnd, (ub1*)bnd->input, (ub1*)bnd->buffer.data, j);
+                        }
                     }
                 }
                 else
@@ -587,6 +624,8 @@ boolean OCI_BindCheckAll
                 }
             }
         }
+
+        bnd->dirty = !OCI_STATUS;
     }
 
     return OCI_STATUS;
@@ -620,6 +659,9 @@ boolean OCI_BindUpdateAll
             bnd_stmt->type   = OCI_CST_SELECT;
         }
 
+        /* output values are copied back whether the bind is tracked or not, only binds
+           explicitly set to OCI_BDM_IN are skipped */
+
         if ((bnd->direction & OCI_BDM_OUT) && (bnd->input) && (bnd->buffer.data))
         {
             if (bnd->alloc)
@@ -628,9 +670,19 @@ boolean OCI_BindUpdateAll
                 {
                     const ub4 count = OCI_IS_PLSQL_STMT(stmt->type) ? bnd->nbelem : stmt->nb_iters;
 
-                    for (ub4 j = 0; j < count && OCI_STATUS; j++)
+                    if (OCI_BIND_IS_BIGINT(bnd))
                     {
-                        OCI_STATUS = OCI_BindUpdate(bnd, (ub1*)bnd->buffer.data, (ub1*)bnd->input, j);
+                        /* OCINumber arrays are decoded to big_int in a single pass */
+
+                        OCI_STATUS = OCI_TranslateNumericArray(stmt->con, bnd->buffer.data, OCI_NUM_NUMBER, sizeof(OCINumber),
+                                                               NULL, bnd->input, bnd->subtype, count);
+                    }
+                    else
+                    {
+                        for (ub4 j = 0; j < count && OCI_STATUS; j++)
+                        {
+                            OCI_STATUS = OCI_BindUpdate(bnd, (ub1*)bnd->buffer.data, (ub1*)bnd->input, j);
+                        }
                     }
                 }
                 else
@@ -830,6 +882,7 @@ OCI_Statement * OCI_StatementInit
         stmt->exec_mode       = OCI_DEFAULT;
         stmt->long_size       = OCI_SIZE_LONG;
         stmt->bind_reuse      = FALSE;
+        stmt->bind_tracking   = FALSE;
         stmt->bind_mode       = OCI_BIND_BY_NAME;
         stmt->long_mode       = OCI_LONG_EXPLICIT;
         stmt->bind_alloc_mode = OCI_BAM_EXTERNAL;
@@ -899,6 +952,7 @@ boolean OCI_StatementClose
 )
 {
     OCI_Error *err = NULL;
+    boolean    res = TRUE;
 
     OCI_CHECK(NULL == stmt, FALSE);
 
@@ -911,9 +965,218 @@ boolean OCI_StatementClose
         err->stmt = NULL;
     }
 
-    /* reset data */
+    /* reset data and release the cached select list description */
+
+    res = OCI_StatementReset(stmt);
+    res = OCI_ColumnCacheFree(stmt) && res;
 
-    return OCI_StatementReset(stmt);
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementDispose
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StatementDispose
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_CHECK(NULL == stmt, FALSE);
+
+    OCI_StatementClose(stmt);
+    OCI_ListRemove(stmt->con->stmts, stmt);
+
+    OCI_FREE(stmt)
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementCacheReset
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StatementCacheReset
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+
+    OCI_CHECK(NULL == stmt, FALSE);
+
+    OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
+
+    /* release what belongs to the previous user. Binds must not survive as their buffers
+       may be released with the statement object (C++ binds for instance) */
+
+    OCI_STATUS = OCI_BatchErrorClear(stmt);
+    OCI_STATUS = OCI_STATUS && OCI_ReleaseResultsets(stmt);
+    OCI_STATUS = OCI_STATUS && OCI_BindFreeAll(stmt);
+
+    if (OCI_STATUS && stmt->map)
+    {
+        OCI_STATUS = OCI_HashFree(stmt->map);
+        stmt->map  = NULL;
+    }
+
+    /* restore the settings of a newly prepared statement */
+
+    if (OCI_STATUS)
+    {
+        stmt->status           = OCI_STMT_PREPARED;
+        stmt->exec_mode        = OCI_DEFAULT;
+        stmt->long_size        = OCI_SIZE_LONG;
+        stmt->long_mode        = OCI_LONG_EXPLICIT;
+        stmt->long_handler     = NULL;
+        stmt->bind_reuse       = TRUE;
+        stmt->bind_tracking    = FALSE;
+        stmt->bind_mode        = OCI_BIND_BY_NAME;
+        stmt->bind_alloc_mode  = OCI_BAM_EXTERNAL;
+        stmt->bind_array       = FALSE;
+        stmt->fetch_size       = OCI_FETCH_SIZE;
+        stmt->fetch_mem        = 0;
+        stmt->fetch_pipelined  = FALSE;
+        stmt->fetch_cache_rows = 0;
+        stmt->fetch_cache_mem  = 0;
+        stmt->chunk_size       = 0;
+        stmt->chunk_mem        = 0;
+        stmt->chunked          = FALSE;
+        stmt->chunk_rows       = 0;
+        stmt->nb_iters         = 1;
+        stmt->nb_iters_init    = 1;
+        stmt->nb_rs            = 0;
+        stmt->cur_rs           = 0;
+        stmt->dynidx           = 0;
+        stmt->err_pos          = 0;
+
+        if (stmt->prefetch_size != OCI_PREFETCH_SIZE)
+        {
+            stmt->prefetch_size = OCI_PREFETCH_SIZE;
+
+            OCI_SET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_PREFETCH_ROWS, stmt->stmt, &stmt->prefetch_size, sizeof(stmt->prefetch_size))
+        }
+
+        if (stmt->prefetch_mem != 0)
+        {
+            stmt->prefetch_mem = 0;
+
+            OCI_SET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_PREFETCH_MEMORY, stmt->stmt, &stmt->prefetch_mem, sizeof(stmt->prefetch_mem))
+        }
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementCacheRelease
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StatementCacheRelease
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_StatementCache *cache  = NULL;
+    OCI_Statement      *victim = NULL;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+
+    OCI_CHECK(NULL == stmt, FALSE);
+
+    OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
+
+    cache = &stmt->con->stmt_cache;
+
+    /* only successfully prepared statements are worth being kept */
+
+    OCI_CHECK(0 == cache->limit, FALSE);
+    OCI_CHECK(NULL == stmt->sql, FALSE);
+    OCI_CHECK(0 == (stmt->status & OCI_STMT_PREPARED), FALSE);
+
+    /* the next user gets the statement as if it was just prepared */
+
+    OCI_STATUS = OCI_StatementCacheReset(stmt);
+
+    OCI_ALLOCATE_DATA(OCI_IPC_STATEMENT_ARRAY, cache->entries, cache->limit)
+
+    if (OCI_STATUS)
+    {
+        /* when the cache is full, the least recently used statement is evicted */
+
+        if (cache->count >= cache->limit)
+        {
+            victim = cache->entries[--cache->count].stmt;
+        }
+
+        memmove(&cache->entries[1], &cache->entries[0], cache->count * sizeof(*cache->entries));
+
+        cache->entries[0].hash = OCI_HashCompute(stmt->sql);
+        cache->entries[0].stmt = stmt;
+
+        cache->count++;
+    }
+
+    if (victim)
+    {
+        OCI_StatementDispose(victim);
+    }
+
+    return OCI_STATUS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementCacheSetLimit
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StatementCacheSetLimit
+(
+    OCI_Connection *con,
+    unsigned int    limit
+)
+{
+    OCI_StatementCache *cache = NULL;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+
+    OCI_CHECK(NULL == con, FALSE);
+
+    OCI_CALL_CONTEXT_SET_FROM_CONN(con)
+
+    cache = &con->stmt_cache;
+
+    /* evict the least recently used statements exceeding the new limit */
+
+    while (cache->count > limit)
+    {
+        OCI_StatementDispose(cache->entries[--cache->count].stmt);
+    }
+
+    /* idle statements array is reallocated on demand with the new limit */
+
+    if (0 == cache->count)
+    {
+        OCI_FREE(cache->entries)
+    }
+    else if (limit != cache->limit)
+    {
+        OCI_StatementCacheEntry *entries = OCI_MemRealloc(cache->entries, OCI_IPC_STATEMENT_ARRAY,
+                                                          sizeof(*entries), (size_t) limit, FALSE);
+
+        OCI_STATUS = (NULL != entries);
+
+        if (OCI_STATUS)
+        {
+            cache->entries = entries;
+        }
+    }
+
+    if (OCI_STATUS)
+    {
+        cache->limit = limit;
+    }
+
+    return OCI_STATUS;
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -979,16 +1242,16 @@ boolean OCI_StatementCheckImplicitResultsets
 
 boolean OCI_BatchErrorInit
 (
-    OCI_Statement *stmt
+    OCI_Statement *stmt,
+    ub4            offset
 )
 {
     ub4 err_count = 0;
+    ub4 first     = 0;
 
     OCI_CALL_DECLARE_CONTEXT(TRUE)
     OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
 
-    OCI_BatchErrorClear(stmt);
-
     /* all OCI call here are not checked for errors as we already dealing
        with an array DML error */
 
@@ -1002,7 +1265,17 @@ boolean OCI_BatchErrorInit
 
         OCI_ALLOCATE_DATA(OCI_IPC_BATCH_ERRORS, stmt->batch, 1)
 
-        /* allocate array of error objects */
+        /* allocate array of error objects or extend it for chunked executions */
+
+        if (OCI_STATUS && stmt->batch->errs)
+        {
+            first = stmt->batch->count;
+
+            stmt->batch->errs = OCI_MemRealloc(stmt->batch->errs, OCI_IPC_ERROR, sizeof(*stmt->batch->errs),
+                                               (size_t) (first + err_count), TRUE);
+
+            OCI_STATUS = (NULL != stmt->batch->errs);
+        }
 
         OCI_ALLOCATE_DATA(OCI_IPC_ERROR, stmt->batch->errs, err_count)
 
@@ -1017,14 +1290,11 @@ boolean OCI_BatchErrorInit
 
         if (OCI_STATUS)
         {
-            stmt->batch->count = err_count;
+            stmt->batch->count = first + err_count;
 
-            for (ub4 i = 0; i < stmt->batch->count; i++)
+            for (ub4 i = 0; i < err_count; i++)
             {
-                int dbsize  = -1;
-                dbtext *dbstr = NULL;
-
-                OCI_Error *err = &stmt->batch->errs[i];
+                OCI_Error *err = &stmt->batch->errs[first + i];
 
                 OCIParamGet((dvoid *) stmt->con->err, OCI_HTYPE_ERROR,
                             stmt->con->err, (dvoid **) (void *) &hndl, i);
@@ -1035,6 +1305,16 @@ boolean OCI_BatchErrorInit
                            (void *) &err->row, (ub4 *) NULL,
                            (ub4) OCI_ATTR_DML_ROW_OFFSET, stmt->con->err);
 
+                /* offsets of chunked executions may be relative to the first row of the chunk.
+                   Chunks hold at most 'offset' rows as 'offset' is a multiple of the chunk size,
+                   thus a relative offset is always lower than 'offset' while an absolute one
+                   is not */
+
+                if (err->row < offset)
+                {
+                    err->row += offset;
+                }
+
                 /* fill error attributes */
 
                 err->type = OCI_ERR_ORACLE;
@@ -1045,21 +1325,9 @@ boolean OCI_BatchErrorInit
 
                 err->row++;
 
-                /* get error string */
+                /* get error code, message is converted on demand */
 
-                dbsize = (int) osizeof(err->str) - 1;
-
-                dbstr = OCI_StringGetOracleString(err->str, &dbsize);
-
-                OCIErrorGet((dvoid *) hndl,
-                            (ub4) 1,
-                            (OraText *) NULL, &err->sqlcode,
-                            (OraText *) dbstr,
-                            (ub4) dbsize,
-                            (ub4) OCI_HTYPE_ERROR);
-
-                OCI_StringCopyOracleStringToNativeString(dbstr, err->str, dbcharcount(dbsize));
-                OCI_StringReleaseOracleString(dbstr);
+                OCI_ErrorGetOracleMessage(err, (dvoid *) hndl);
             }
         }
 
@@ -1074,6 +1342,153 @@ boolean OCI_BatchErrorInit
     return OCI_STATUS;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementGetChunkSize
+ * --------------------------------------------------------------------------------------------- */
+
+ub4 OCI_StatementGetChunkSize
+(
+    OCI_Statement *stmt,
+    ub4            iters,
+    ub4            mode
+)
+{
+    ub4 chunk = iters;
+
+    OCI_CHECK(NULL == stmt, iters)
+
+    /* only plain array DML can be split into several executions */
+
+    OCI_CHECK(iters <= 1, iters)
+    OCI_CHECK(0 == stmt->chunk_size && 0 == stmt->chunk_mem, iters)
+    OCI_CHECK(OCI_IS_PLSQL_STMT(stmt->type), iters)
+    OCI_CHECK(stmt->nb_rbinds > 0, iters)
+    OCI_CHECK(mode & (OCI_PARSE_ONLY | OCI_DESCRIBE_ONLY), iters)
+
+    for (ub4 i = 0; i < stmt->nb_ubinds; i++)
+    {
+        OCI_CHECK(OCI_CDT_LONG == stmt->ubinds[i]->type, iters)
+    }
+
+    if (stmt->chunk_size > 0 && stmt->chunk_size < chunk)
+    {
+        chunk = stmt->chunk_size;
+    }
+
+    /* bound the amount of bind data sent per round trip */
+
+    if (stmt->chunk_mem > 0)
+    {
+        size_t size = 0;
+        ub4    rows = 0;
+
+        for (ub4 i = 0; i < stmt->nb_ubinds; i++)
+        {
+            const OCI_Bind *bnd = stmt->ubinds[i];
+
+            if (bnd->is_array)
+            {
+                size += (size_t) bnd->size + sizeof(sb2) + (size_t) bnd->buffer.sizelen;
+            }
+        }
+
+        rows = (size > 0) ? (ub4) (stmt->chunk_mem / size) : chunk;
+
+        if (rows < chunk)
+        {
+            chunk = (rows > 0) ? rows : 1;
+        }
+    }
+
+    return chunk;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementExecuteChunks
+ * --------------------------------------------------------------------------------------------- */
+
+sword OCI_StatementExecuteChunks
+(
+    OCI_Statement *stmt,
+    ub4            iters,
+    ub4            chunk,
+    ub4            mode
+)
+{
+    sword   status = OCI_SUCCESS;
+    sword   result = OCI_SUCCESS;
+    boolean failed = FALSE;
+    ub4     offset = 0;
+
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
+
+    stmt->chunked    = TRUE;
+    stmt->chunk_rows = 0;
+
+    while (offset < iters)
+    {
+        const ub4 count  = (iters - offset < chunk) ? (iters - offset) : chunk;
+        ub4       rows   = 0;
+        ub4       errors = stmt->batch ? stmt->batch->count : 0;
+
+        /* bind arrays are executed in place from the chunk first row */
+
+        status = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, count, offset,
+                                (OCISnapshot *)NULL, (OCISnapshot *)NULL, mode);
+
+        if ((OCI_SUCCESS == status) || (OCI_SUCCESS_WITH_INFO == status) || (OCI_ERROR == status))
+        {
+            OCIAttrGet((dvoid *) stmt->stmt, (ub4) OCI_HTYPE_STMT, (dvoid *) &rows,
+                       (ub4 *) NULL, (ub4) OCI_ATTR_ROW_COUNT, stmt->con->err);
+
+            stmt->chunk_rows += rows;
+        }
+
+        if (mode & OCI_BATCH_ERRORS)
+        {
+            OCI_BatchErrorInit(stmt, offset);
+        }
+
+        offset += count;
+
+        if (OCI_SUCCESS_WITH_INFO == status)
+        {
+            OCI_ExceptionOCI(stmt->con->err, stmt->con, stmt, TRUE);
+        }
+        else if ((OCI_SUCCESS != status) && (OCI_NO_DATA != status))
+        {
+            /* rows in error are reported in batch errors and following chunks are still
+               executed. Any other error stops the execution */
+
+            const boolean rows_in_error = (stmt->batch && stmt->batch->count > errors);
+
+            /* errors are raised here as the error handle is overwritten by next chunks */
+
+            if (!failed || !rows_in_error)
+            {
+                /* get parse error position of the failing chunk */
+
+                OCIAttrGet((dvoid *)stmt->stmt, (ub4)OCI_HTYPE_STMT,
+                           (dvoid *)&stmt->err_pos, (ub4 *)NULL,
+                           (ub4)OCI_ATTR_PARSE_ERROR_OFFSET, stmt->con->err);
+
+                OCI_ExceptionOCI(stmt->con->err, stmt->con, stmt, FALSE);
+            }
+
+            failed = TRUE;
+            result = status;
+
+            if (!rows_in_error)
+            {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_PrepareInternal
  * --------------------------------------------------------------------------------------------- */
@@ -1211,6 +1626,8 @@ boolean OCI_API OCI_ExecuteInternal
 
     OCI_BatchErrorClear(stmt);
 
+    stmt->chunked = FALSE;
+
     /* check bind objects for updating their null indicator status */
 
     OCI_STATUS = OCI_BindCheckAll(stmt);
@@ -1242,9 +1659,19 @@ boolean OCI_API OCI_ExecuteInternal
 
     if (OCI_STATUS)
     {
+        const ub4 chunk = OCI_StatementGetChunkSize(stmt, iters, mode);
+
+        if (chunk < iters)
+        {
+            /* oversized array DML is executed in several round trips */
 
-        status = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, iters,
-                                (ub4)0, (OCISnapshot *)NULL, (OCISnapshot *)NULL, mode);
+            status = OCI_StatementExecuteChunks(stmt, iters, chunk, mode);
+        }
+        else
+        {
+            status = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, iters,
+                                    (ub4)0, (OCISnapshot *)NULL, (OCISnapshot *)NULL, mode);
+        }
     }
 
     /* check result */
@@ -1252,7 +1679,7 @@ boolean OCI_API OCI_ExecuteInternal
     OCI_STATUS = ((OCI_SUCCESS   == status) || (OCI_SUCCESS_WITH_INFO == status) ||
                   (OCI_NEED_DATA == status) || (OCI_NO_DATA == status));
 
-    if (OCI_SUCCESS_WITH_INFO == status)
+    if ((OCI_SUCCESS_WITH_INFO == status) && !stmt->chunked)
     {
         OCI_ExceptionOCI(stmt->con->err, stmt->con, stmt, TRUE);
     }
@@ -1263,7 +1690,10 @@ boolean OCI_API OCI_ExecuteInternal
     {
         /* build batch error list if the statement is array DML */
 
-        OCI_BatchErrorInit(stmt);
+        if (!stmt->chunked)
+        {
+            OCI_BatchErrorInit(stmt, 0);
+        }
 
         if (stmt->batch)
         {
@@ -1318,7 +1748,7 @@ boolean OCI_API OCI_ExecuteInternal
 
         }
     }
-    else
+    else if (!stmt->chunked)
     {
         /* get parse error position type */
 
@@ -1387,16 +1817,84 @@ boolean OCI_API OCI_StatementFree
     OCI_CALL_CHECK_OBJECT_FETCHED(stmt)
     OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
 
-    OCI_StatementClose(stmt);
-    OCI_ListRemove(stmt->con->stmts, stmt);
+    /* statements obtained from the connection cache are kept prepared for reuse */
 
-    OCI_FREE(stmt)
+    if (!stmt->cached || !OCI_StatementCacheRelease(stmt))
+    {
+        OCI_StatementDispose(stmt);
+    }
 
     OCI_RETVAL = TRUE;
 
     OCI_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetCachedStatement
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Statement * OCI_API OCI_GetCachedStatement
+(
+    OCI_Connection *con,
+    const otext    *sql
+)
+{
+    OCI_StatementCache *cache = NULL;
+    unsigned int        hash  = 0;
+    unsigned int        i     = 0;
+
+    OCI_CALL_ENTER(OCI_Statement *, NULL)
+    OCI_CALL_CHECK_PTR(OCI_IPC_CONNECTION, con)
+    OCI_CALL_CHECK_PTR(OCI_IPC_STRING, sql)
+    OCI_CALL_CONTEXT_SET_FROM_CONN(con)
+
+    cache = &con->stmt_cache;
+    hash  = OCI_HashCompute(sql);
+
+    /* look for the most recently used idle statement prepared with the same SQL */
+
+    for (i = 0; i < cache->count; i++)
+    {
+        if ((cache->entries[i].hash == hash) && (ostrcmp(cache->entries[i].stmt->sql, sql) == 0))
+        {
+            OCI_RETVAL = cache->entries[i].stmt;
+
+            cache->count--;
+
+            memmove(&cache->entries[i], &cache->entries[i + 1], (cache->count - i) * sizeof(*cache->entries));
+
+            break;
+        }
+    }
+
+    /* otherwise, prepare a new statement that will be returned to the cache when freed */
+
+    if (!OCI_RETVAL)
+    {
+        OCI_RETVAL = OCI_StatementCreate(con);
+        OCI_STATUS = (NULL != OCI_RETVAL);
+
+        if (OCI_STATUS)
+        {
+            OCI_RETVAL->bind_reuse = TRUE;
+
+            OCI_STATUS = OCI_PrepareInternal(OCI_RETVAL, sql);
+        }
+
+        if (OCI_STATUS)
+        {
+            OCI_RETVAL->cached = TRUE;
+        }
+        else if (OCI_RETVAL)
+        {
+            OCI_StatementFree(OCI_RETVAL);
+            OCI_RETVAL = NULL;
+        }
+    }
+
+    OCI_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ReleaseResultsets
  * --------------------------------------------------------------------------------------------- */
@@ -1809,6 +2307,16 @@ boolean OCI_API OCI_BindArraySetSize
     }
     else
     {
+        /* binds must be checked again for the new number of iterations */
+
+        if (stmt->nb_iters != size)
+        {
+            for (ub2 i = 0; i < stmt->nb_ubinds; i++)
+            {
+                stmt->ubinds[i]->dirty = TRUE;
+            }
+        }
+
         stmt->nb_iters   = size;
         stmt->bind_array = TRUE;
 
@@ -1835,6 +2343,56 @@ unsigned int OCI_API OCI_BindArrayGetSize
     OCI_GET_PROP(unsigned int, 0, OCI_IPC_STATEMENT, stmt, nb_iters, stmt->con, stmt, stmt->con->err)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindArraySetChunkSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_BindArraySetChunkSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    OCI_SET_PROP(ub4, OCI_IPC_STATEMENT, stmt, chunk_size, size, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindArrayGetChunkSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_BindArrayGetChunkSize
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(unsigned int, 0, OCI_IPC_STATEMENT, stmt, chunk_size, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindArraySetChunkMemory
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_BindArraySetChunkMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    OCI_SET_PROP(ub4, OCI_IPC_STATEMENT, stmt, chunk_mem, size, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindArrayGetChunkMemory
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_BindArrayGetChunkMemory
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(unsigned int, 0, OCI_IPC_STATEMENT, stmt, chunk_mem, stmt->con, stmt, stmt->con->err)
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_AllowRebinding
  * --------------------------------------------------------------------------------------------- */
@@ -1860,6 +2418,46 @@ boolean OCI_API OCI_IsRebindingAllowed
     OCI_GET_PROP(boolean, FALSE, OCI_IPC_STATEMENT, stmt, bind_reuse, stmt->con, stmt, stmt->con->err)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_EnableBindTracking
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_EnableBindTracking
+(
+    OCI_Statement *stmt,
+    boolean        value
+)
+{
+    OCI_CALL_ENTER(boolean, FALSE)
+    OCI_CALL_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
+
+    /* existing binds may have been modified since the last execution */
+
+    for (ub2 i = 0; i < stmt->nb_ubinds; i++)
+    {
+        stmt->ubinds[i]->dirty = TRUE;
+    }
+
+    stmt->bind_tracking = value;
+
+    OCI_RETVAL = OCI_STATUS;
+
+    OCI_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_IsBindTrackingEnabled
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_IsBindTrackingEnabled
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(boolean, FALSE, OCI_IPC_STATEMENT, stmt, bind_tracking, stmt->con, stmt, stmt->con->err)
+}
+
 /* --------------------------------------------------------------------------------------------- *
 * OCI_BindBoolean
 * --------------------------------------------------------------------------------------------- */
@@ -3328,6 +3926,106 @@ unsigned int OCI_API OCI_GetFetchSize
     OCI_GET_PROP(unsigned int, 0, OCI_IPC_STATEMENT, stmt, fetch_size, stmt->con, stmt, stmt->con->err)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetFetchMemory
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetFetchMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    OCI_SET_PROP(ub4, OCI_IPC_STATEMENT, stmt, fetch_mem, size, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetFetchMemory
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetFetchMemory
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(unsigned int, 0, OCI_IPC_STATEMENT, stmt, fetch_mem, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetPipelinedFetch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetPipelinedFetch
+(
+    OCI_Statement *stmt,
+    boolean        value
+)
+{
+    OCI_SET_PROP(boolean, OCI_IPC_STATEMENT, stmt, fetch_pipelined, value, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetPipelinedFetch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetPipelinedFetch
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(boolean, FALSE, OCI_IPC_STATEMENT, stmt, fetch_pipelined, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetFetchCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetFetchCacheSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    OCI_SET_PROP(ub4, OCI_IPC_STATEMENT, stmt, fetch_cache_rows, size, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetFetchCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetFetchCacheSize
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(unsigned int, 0, OCI_IPC_STATEMENT, stmt, fetch_cache_rows, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetFetchCacheMemory
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetFetchCacheMemory
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    OCI_SET_PROP(ub4, OCI_IPC_STATEMENT, stmt, fetch_cache_mem, size, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetFetchCacheMemory
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetFetchCacheMemory
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(unsigned int, 0, OCI_IPC_STATEMENT, stmt, fetch_cache_mem, stmt->con, stmt, stmt->con->err)
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_PrefetchSize
  * --------------------------------------------------------------------------------------------- */
@@ -3470,6 +4168,31 @@ unsigned int OCI_API OCI_GetLongMode
     OCI_GET_PROP(unsigned int, OCI_UNKNOWN, OCI_IPC_STATEMENT, stmt, long_mode, stmt->con, stmt, stmt->con->err)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetLongHandler
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetLongHandler
+(
+    OCI_Statement    *stmt,
+    POCI_LONG_HANDLER handler
+)
+{
+    OCI_SET_PROP(POCI_LONG_HANDLER, OCI_IPC_STATEMENT, stmt, long_handler, handler, stmt->con, stmt, stmt->con->err)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetLongHandler
+ * --------------------------------------------------------------------------------------------- */
+
+POCI_LONG_HANDLER OCI_API OCI_GetLongHandler
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_GET_PROP(POCI_LONG_HANDLER, NULL, OCI_IPC_STATEMENT, stmt, long_handler, stmt->con, stmt, stmt->con->err)
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_StatementGetConnection
  * --------------------------------------------------------------------------------------------- */
@@ -3528,13 +4251,38 @@ unsigned int OCI_API OCI_GetAffectedRows
     OCI_Statement *stmt
 )
 {
-    ub4 count = 0;
+    OCI_Resultset *rs    = NULL;
+    ub4            count = 0;
 
     OCI_CALL_ENTER(unsigned int, count)
     OCI_CALL_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     OCI_CALL_CONTEXT_SET_FROM_STMT(stmt)
 
-    OCI_GET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_ROW_COUNT, stmt->stmt, &count, NULL)
+    rs = (stmt->rsts && (OCI_CST_SELECT == stmt->type)) ? stmt->rsts[0] : NULL;
+
+    /* the statement handle cannot be queried while a background fetch is using it */
+
+    if (rs && rs->pipe)
+    {
+        OCI_STATUS = OCI_FetchPipelineJoin(rs);
+    }
+
+    if (stmt->chunked)
+    {
+        /* rows affected by all the chunks of the last execution */
+
+        count = stmt->chunk_rows;
+    }
+    else if (rs && rs->pipe && rs->pipe->ready)
+    {
+        /* rows fetched in background are not counted until they are consumed */
+
+        count = rs->row_count;
+    }
+    else
+    {
+        OCI_GET_ATTRIB(OCI_HTYPE_STMT, OCI_ATTR_ROW_COUNT, stmt->stmt, &count, NULL)
+    }
 
     OCI_RETVAL = count;
 
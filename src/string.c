@@ -20,6 +20,12 @@
 
 #include "ocilib_internal.h"
 
+#if defined(OCI_SIMD_AVX2)
+  #include <immintrin.h>
+#elif defined(OCI_SIMD_SSE2)
+  #include <emmintrin.h>
+#endif
+
 /* ********************************************************************************************* *
  *                             PRIVATE FUNCTIONS
  * ********************************************************************************************* */
@@ -138,11 +144,376 @@ boolean OCI_StringRequestBuffer
     return res;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringHasAVX2
+ * --------------------------------------------------------------------------------------------- */
+
+#if defined(OCI_SIMD_AVX2)
+
+static boolean OCI_StringHasAVX2
+(
+    void
+)
+{
+    static int avx2 = -1;
+
+    if (avx2 < 0)
+    {
+        avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+
+    return (boolean) avx2;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringFindSurrogateAVX2
+ * --------------------------------------------------------------------------------------------- */
+
+__attribute__((target("avx2")))
+static int OCI_StringFindSurrogateAVX2
+(
+    const unsigned short *src,
+    int                   count
+)
+{
+    const __m256i mask = _mm256_set1_epi16((short) 0xF800);
+    const __m256i surr = _mm256_set1_epi16((short) 0xD800);
+    int i = 0;
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *) (src + i));
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(v, mask), surr)))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringExpand16To32AVX2
+ * --------------------------------------------------------------------------------------------- */
+
+__attribute__((target("avx2")))
+static int OCI_StringExpand16To32AVX2
+(
+    const unsigned short *src,
+    unsigned int         *dst,
+    int                   count
+)
+{
+    /* backward, so that in place expansion never overwrites pending input */
+
+    while (count >= 16)
+    {
+        __m256i v;
+
+        count -= 16;
+
+        v = _mm256_loadu_si256((const __m256i *) (src + count));
+
+        _mm256_storeu_si256((__m256i *) (dst + count + 8), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1)));
+        _mm256_storeu_si256((__m256i *) (dst + count),     _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v)));
+    }
+
+    return count;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringPack32To16AVX2
+ * --------------------------------------------------------------------------------------------- */
+
+__attribute__((target("avx2")))
+static int OCI_StringPack32To16AVX2
+(
+    const unsigned int *src,
+    unsigned short     *dst,
+    int                 count
+)
+{
+    int i = 0;
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i a = _mm256_loadu_si256((const __m256i *) (src + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i *) (src + i + 8));
+        const __m256i h = _mm256_srli_epi32(_mm256_or_si256(a, b), 16);
+
+        if (!_mm256_testz_si256(h, h))
+        {
+            break;
+        }
+
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8));
+    }
+
+    return i;
+}
+
+#endif
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringFindSurrogate
+ * --------------------------------------------------------------------------------------------- */
+
+static int OCI_StringFindSurrogate
+(
+    const unsigned short *src,
+    int                   count
+)
+{
+    int i = 0;
+
+#if defined(OCI_SIMD_AVX2)
+
+    if (OCI_StringHasAVX2())
+    {
+        i = OCI_StringFindSurrogateAVX2(src, count);
+    }
+
+#endif
+
+#if defined(OCI_SIMD_SSE2)
+
+    {
+        const __m128i mask = _mm_set1_epi16((short) 0xF800);
+        const __m128i surr = _mm_set1_epi16((short) 0xD800);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i *) (src + i));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask), surr)))
+            {
+                break;
+            }
+        }
+    }
+
+#endif
+
+    while (i < count && !OCI_UTF16_IS_SURROGATE(src[i]))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringExpand16To32
+ * --------------------------------------------------------------------------------------------- */
+
+static void OCI_StringExpand16To32
+(
+    const unsigned short *src,
+    unsigned int         *dst,
+    int                   count
+)
+{
+#if defined(OCI_SIMD_AVX2)
+
+    if (OCI_StringHasAVX2())
+    {
+        count = OCI_StringExpand16To32AVX2(src, dst, count);
+    }
+
+#endif
+
+#if defined(OCI_SIMD_SSE2)
+
+    {
+        const __m128i zero = _mm_setzero_si128();
+
+        while (count >= 8)
+        {
+            __m128i v;
+
+            count -= 8;
+
+            v = _mm_loadu_si128((const __m128i *) (src + count));
+
+            _mm_storeu_si128((__m128i *) (dst + count + 4), _mm_unpackhi_epi16(v, zero));
+            _mm_storeu_si128((__m128i *) (dst + count),     _mm_unpacklo_epi16(v, zero));
+        }
+    }
+
+#endif
+
+    while (count--)
+    {
+        dst[count] = (unsigned int) src[count];
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringUTF16ToUTF32Count
+ * --------------------------------------------------------------------------------------------- */
+
+int OCI_StringUTF16ToUTF32Count
+(
+    const unsigned short *src,
+    unsigned int         *dst,
+    int                   count
+)
+{
+    /* code units before the first surrogate keep their position and are expanded as is.
+       From there, valid surrogate pairs are combined, so the output is shorter than the
+       input and the conversion runs backward from its final length to remain safe when
+       performed in place. Unpaired surrogates are copied unchanged */
+
+    const int first = OCI_StringFindSurrogate(src, count);
+
+    int pairs = 0;
+    int i     = first;
+    int j     = 0;
+
+    while (i < count)
+    {
+        if (OCI_UTF16_IS_HIGH(src[i]) && (i + 1 < count) && OCI_UTF16_IS_LOW(src[i + 1]))
+        {
+            pairs++;
+            i++;
+        }
+
+        i++;
+    }
+
+    i = count;
+    j = count - pairs;
+
+    while (i > first)
+    {
+        const unsigned int c = src[--i];
+
+        if (OCI_UTF16_IS_LOW(c) && (i > first) && OCI_UTF16_IS_HIGH(src[i - 1]))
+        {
+            i--;
+
+            dst[--j] = 0x10000 + (((src[i] - 0xD800u) << 10) | (c - 0xDC00u));
+        }
+        else
+        {
+            dst[--j] = c;
+        }
+    }
+
+    OCI_StringExpand16To32(src, dst, first);
+
+    return count - pairs;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StringUTF32ToUTF16Count
+ * --------------------------------------------------------------------------------------------- */
+
+int OCI_StringUTF32ToUTF16Count
+(
+    const unsigned int *src,
+    unsigned short     *dst,
+    int                 count,
+    int                 capacity,
+    int                *done
+)
+{
+    /* supplementary characters are encoded as surrogate pairs as long as the output fits in
+       'capacity' code units. The conversion runs forward and the output position never
+       goes past the input position in bytes, so it is safe when performed in place */
+
+    int i = 0;
+    int j = 0;
+
+    while (i < count)
+    {
+        int n = 0;
+
+    #if defined(OCI_SIMD_AVX2)
+
+        if (OCI_StringHasAVX2())
+        {
+            n = OCI_StringPack32To16AVX2(src + i, dst + j, min(count - i, capacity - j));
+
+            i += n;
+            j += n;
+        }
+
+    #endif
+
+    #if defined(OCI_SIMD_SSE2)
+
+        {
+            const __m128i bias = _mm_set1_epi32(0x8000);
+            const __m128i back = _mm_set1_epi16((short) 0x8000);
+            const __m128i zero = _mm_setzero_si128();
+            const int     max  = min(count - i, capacity - j);
+
+            for (n = 0; n + 8 <= max; n += 8)
+            {
+                const __m128i a = _mm_loadu_si128((const __m128i *) (src + i + n));
+                const __m128i b = _mm_loadu_si128((const __m128i *) (src + i + n + 4));
+                const __m128i h = _mm_srli_epi32(_mm_or_si128(a, b), 16);
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(h, zero)) != 0xFFFF)
+                {
+                    break;
+                }
+
+                /* SSE2 only has a signed saturating pack, so values are biased into its range */
+
+                _mm_storeu_si128((__m128i *) (dst + j + n), _mm_add_epi16(_mm_packs_epi32(_mm_sub_epi32(a, bias),
+                                                                                          _mm_sub_epi32(b, bias)), back));
+            }
+
+            i += n;
+            j += n;
+        }
+
+    #endif
+
+        if (i < count)
+        {
+            const unsigned int c = src[i];
+
+            if (c > 0xFFFF && c <= 0x10FFFF)
+            {
+                if (j + 2 > capacity)
+                {
+                    break;
+                }
+
+                dst[j++] = (unsigned short) (0xD800 + ((c - 0x10000) >> 10));
+                dst[j++] = (unsigned short) (0xDC00 + ((c - 0x10000) & 0x3FF));
+            }
+            else
+            {
+                if (j + 1 > capacity)
+                {
+                    break;
+                }
+
+                dst[j++] = (unsigned short) (c > 0xFFFF ? OCI_UTF16_REPLACEMENT : c);
+            }
+
+            i++;
+        }
+    }
+
+    if (done)
+    {
+        *done = i;
+    }
+
+    return j;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_StringTranslate
  * --------------------------------------------------------------------------------------------- */
 
-void OCI_StringTranslate
+int OCI_StringTranslate
 (
     void  *src,
     void  *dst,
@@ -151,18 +522,18 @@ void OCI_StringTranslate
     size_t size_char_out
 )
 {
-    const int len = char_count;
+    int len = char_count;
 
     if (!src || !dst)
     {
-        return;
+        return 0;
     }
 
     /* raw string packing/expansion without charset conversion */
 
     if (size_char_out > size_char_in)
     {
-        /* expand string */
+        /* expand string, backward to allow in place conversion */
 
         if ((size_char_in == sizeof(short)) && (size_char_out == sizeof(int)))
         {
@@ -173,13 +544,10 @@ void OCI_StringTranslate
 
             if (*str1 == 0)
             {
-                return;
+                return 0;
             }
 
-            while (char_count--)
-            {
-                str2[char_count] = (unsigned int) str1[char_count];
-            }
+            len = OCI_StringUTF16ToUTF32Count(str1, str2, char_count);
         }
 
         else if ((size_char_in == sizeof(char)) && (size_char_out == sizeof(short)))
@@ -191,9 +559,29 @@ void OCI_StringTranslate
 
             if (*str1 == 0)
             {
-                return;
+                return 0;
             }
 
+        #if defined(OCI_SIMD_SSE2)
+
+            {
+                const __m128i zero = _mm_setzero_si128();
+
+                while (char_count >= 16)
+                {
+                    __m128i v;
+
+                    char_count -= 16;
+
+                    v = _mm_loadu_si128((const __m128i *) (str1 + char_count));
+
+                    _mm_storeu_si128((__m128i *) (str2 + char_count + 8), _mm_unpackhi_epi8(v, zero));
+                    _mm_storeu_si128((__m128i *) (str2 + char_count),     _mm_unpacklo_epi8(v, zero));
+                }
+            }
+
+        #endif
+
             while (char_count--)
             {
                 str2[char_count] = (unsigned short) str1[char_count];
@@ -208,9 +596,33 @@ void OCI_StringTranslate
 
             if (*str1 == 0)
             {
-                return;
+                return 0;
             }
 
+        #if defined(OCI_SIMD_SSE2)
+
+            {
+                const __m128i zero = _mm_setzero_si128();
+
+                while (char_count >= 16)
+                {
+                    __m128i v, lo, hi;
+
+                    char_count -= 16;
+
+                    v  = _mm_loadu_si128((const __m128i *) (str1 + char_count));
+                    lo = _mm_unpacklo_epi8(v, zero);
+                    hi = _mm_unpackhi_epi8(v, zero);
+
+                    _mm_storeu_si128((__m128i *) (str2 + char_count + 12), _mm_unpackhi_epi16(hi, zero));
+                    _mm_storeu_si128((__m128i *) (str2 + char_count + 8),  _mm_unpacklo_epi16(hi, zero));
+                    _mm_storeu_si128((__m128i *) (str2 + char_count + 4),  _mm_unpackhi_epi16(lo, zero));
+                    _mm_storeu_si128((__m128i *) (str2 + char_count),      _mm_unpacklo_epi16(lo, zero));
+                }
+            }
+
+        #endif
+
             while (char_count--)
             {
                str2[char_count] = (unsigned int) str1[char_count];
@@ -227,18 +639,17 @@ void OCI_StringTranslate
 
             unsigned int *str1   = (unsigned int   *) src;
             unsigned short *str2 = (unsigned short *) dst;
-            int i                = 0;
 
             if (*str1 == 0)
             {
-                return;
+                return 0;
             }
 
-            while (i < char_count)
-            {
-                str2[i] = (unsigned short) str1[i];
-                 i++;
-            }
+            /* supplementary characters take 2 code units. The output is not bounded here and
+               callers must provide room for them. See OCI_StringUTF32ToUTF16Count() for
+               bounded conversions */
+
+            len = OCI_StringUTF32ToUTF16Count(str1, str2, char_count, char_count * 2, NULL);
         }
         else if ((size_char_in == sizeof(short)) && (size_char_out == sizeof(char)))
         {
@@ -250,9 +661,25 @@ void OCI_StringTranslate
 
             if (*str1 == 0)
             {
-                return;
+                return 0;
+            }
+
+        #if defined(OCI_SIMD_SSE2)
+
+            {
+                const __m128i mask = _mm_set1_epi16(0x00FF);
+
+                for (; i + 16 <= char_count; i += 16)
+                {
+                    const __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i *) (str1 + i)),     mask);
+                    const __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i *) (str1 + i + 8)), mask);
+
+                    _mm_storeu_si128((__m128i *) (str2 + i), _mm_packus_epi16(a, b));
+                }
             }
 
+        #endif
+
             while (i < char_count)
             {
                 str2[i] = (unsigned char) str1[i];
@@ -269,9 +696,27 @@ void OCI_StringTranslate
 
             if (*str1 == 0)
             {
-                return;
+                return 0;
             }
 
+        #if defined(OCI_SIMD_SSE2)
+
+            {
+                const __m128i mask = _mm_set1_epi32(0x000000FF);
+
+                for (; i + 16 <= char_count; i += 16)
+                {
+                    const __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i *) (str1 + i)),      mask);
+                    const __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i *) (str1 + i + 4)),  mask);
+                    const __m128i c = _mm_and_si128(_mm_loadu_si128((const __m128i *) (str1 + i + 8)),  mask);
+                    const __m128i d = _mm_and_si128(_mm_loadu_si128((const __m128i *) (str1 + i + 12)), mask);
+
+                    _mm_storeu_si128((__m128i *) (str2 + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+                }
+            }
+
+        #endif
+
             while (i < char_count)
             {
                 str2[i] = (unsigned char) str1[i];
@@ -285,6 +730,8 @@ void OCI_StringTranslate
     }
 
     memset(((char*) dst) + len * size_char_out, 0, size_char_out);
+
+    return len;
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -321,7 +768,32 @@ dbtext * OCI_StringGetOracleString
 
         if (dst)
         {
-            OCI_StringUTF32ToUTF16( src, dst, len );   
+            /* supplementary characters take 2 UTF-16 code units, grow the buffer when met */
+
+            const unsigned int *str = (const unsigned int *) src;
+
+            int done  = 0;
+            int count = OCI_StringUTF32ToUTF16Count(str, (unsigned short *) dst, len, len, &done);
+
+            if (done < len)
+            {
+                const int capacity = count + (len - done) * 2;
+
+                dst = (dbtext *) OCI_MemRealloc(dst, OCI_IPC_STRING, sizeof(dbtext), (size_t) (capacity + 1), FALSE);
+
+                if (dst)
+                {
+                    count += OCI_StringUTF32ToUTF16Count(str + done, (unsigned short *) dst + count,
+                                                         len - done, capacity - count, NULL);
+                }
+            }
+
+            if (dst)
+            {
+                dst[count] = 0;
+            }
+
+            len = count;
         }
     }
     else
@@ -362,7 +834,9 @@ int OCI_StringCopyOracleStringToNativeString
 {
     if (OCILib.use_wide_char_conv)
     {
-        OCI_StringUTF16ToUTF32((void *) src, (void *) dst, len);   
+        /* surrogate pairs are combined, so the converted string may be shorter */
+
+        len = OCI_StringUTF16ToUTF32((void *) src, (void *) dst, len);
     }
 
     return len;
@@ -41,6 +41,38 @@ void OCI_ThreadProc
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ThreadReset
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ThreadReset
+(
+    OCI_Thread *thread
+)
+{
+    OCI_CALL_DECLARE_CONTEXT(TRUE)
+    OCI_CALL_CONTEXT_SET_FROM_ERR(thread->err)
+
+    /* a joined thread handle cannot be run again, thus it is replaced by a new one */
+
+    if (thread->handle)
+    {
+        OCI_EXEC(OCIThreadClose(OCILib.env, thread->err, thread->handle))
+        OCI_EXEC(OCIThreadHndDestroy(OCILib.env, thread->err, &thread->handle))
+    }
+
+    thread->handle = NULL;
+
+    OCI_EXEC(OCIThreadHndInit(OCILib.env, thread->err, &thread->handle))
+
+    if (!OCI_STATUS)
+    {
+        thread->handle = NULL;
+    }
+
+    return OCI_STATUS;
+}
+
 /* ********************************************************************************************* *
  *                            PUBLIC FUNCTIONS
  * ********************************************************************************************* */
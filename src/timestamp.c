@@ -521,6 +521,7 @@ boolean OCI_API OCI_TimestampToText
     dbtext *dbstr2  = NULL;
     int     dbsize1 = size * (int) sizeof(otext);
     int     dbsize2 = -1;
+    int     len     = 0;
 
     OCI_CALL_ENTER(boolean, FALSE)
     OCI_CALL_CHECK_PTR(OCI_IPC_TIMESTAMP, tmsp)
@@ -552,14 +553,14 @@ boolean OCI_API OCI_TimestampToText
                           (ub4*) &dbsize1, (OraText *) dbstr1)
     )
 
-    OCI_StringCopyOracleStringToNativeString(dbstr1, str, dbcharcount(dbsize1));
+    len = OCI_StringCopyOracleStringToNativeString(dbstr1, str, dbcharcount(dbsize1));
 
     OCI_StringReleaseOracleString(dbstr1);
     OCI_StringReleaseOracleString(dbstr2);
 
     /* set null string terminator */
 
-    str[dbcharcount(dbsize1)] = 0;
+    str[len] = 0;
 
 #else
 
@@ -567,6 +568,7 @@ boolean OCI_API OCI_TimestampToText
     OCI_NOT_USED(dbstr2)
     OCI_NOT_USED(dbsize1)
     OCI_NOT_USED(dbsize2)
+    OCI_NOT_USED(len)
     OCI_NOT_USED(precision)
 
 #endif
@@ -716,6 +718,7 @@ boolean OCI_API OCI_TimestampGetTimeZoneName
 {
     dbtext *dbstr  = NULL;
     int     dbsize  = size * (int) sizeof(otext);
+    int     len     = 0;
 
     OCI_CALL_ENTER(boolean, FALSE)
     OCI_CALL_CHECK_PTR(OCI_IPC_TIMESTAMP, tmsp)
@@ -729,12 +732,12 @@ boolean OCI_API OCI_TimestampGetTimeZoneName
 
     OCI_EXEC(OCIDateTimeGetTimeZoneName((dvoid *)tmsp->env, tmsp->err, tmsp->handle, (ub1*) dbstr, (ub4*) &dbsize))
 
-    OCI_StringCopyOracleStringToNativeString(dbstr, str, dbcharcount(dbsize));
+    len = OCI_StringCopyOracleStringToNativeString(dbstr, str, dbcharcount(dbsize));
     OCI_StringReleaseOracleString(dbstr);
 
     /* set null string terminator */
 
-    str[dbcharcount(dbsize)] = 0;
+    str[len] = 0;
 
 #else
 
@@ -742,6 +745,7 @@ boolean OCI_API OCI_TimestampGetTimeZoneName
     OCI_NOT_USED(size)
     OCI_NOT_USED(dbstr)
     OCI_NOT_USED(dbsize)
+    OCI_NOT_USED(len)
 
 #endif
 
@@ -0,0 +1,287 @@
+#include "ocilib_tests.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WINDOWS
+#include <io.h>
+#define fileno _fileno
+#endif
+
+#define ARROW_QUERY OTEXT("select cast(level as number(10)) as id, case when level = 2 then null else rpad('x', level, 'x') end as txt from dual connect by level <= 3")
+
+#define ARROW_HEADER_SCHEMA         1
+#define ARROW_HEADER_RECORD_BATCH   3
+#define ARROW_TYPE_INT              2
+#define ARROW_TYPE_UTF8             5
+
+using Bytes = std::vector<unsigned char>;
+
+static uint64_t ReadLE(const Bytes& bytes, size_t pos, size_t size)
+{
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        value |= static_cast<uint64_t>(bytes.at(pos + i)) << (i * 8);
+    }
+
+    return value;
+}
+
+static size_t Deref(const Bytes& bytes, size_t pos)
+{
+    return pos + static_cast<size_t>(ReadLE(bytes, pos, 4));
+}
+
+static size_t GetField(const Bytes& bytes, size_t table, unsigned int index)
+{
+    const size_t vtable = table - static_cast<size_t>(static_cast<int32_t>(ReadLE(bytes, table, 4)));
+    const size_t vtsize = static_cast<size_t>(ReadLE(bytes, vtable, 2));
+    const size_t entry  = 4 + 2 * static_cast<size_t>(index);
+
+    if (entry >= vtsize)
+    {
+        return 0;
+    }
+
+    const size_t offset = static_cast<size_t>(ReadLE(bytes, vtable + entry, 2));
+
+    return offset ? table + offset : 0;
+}
+
+static std::string GetString(const Bytes& bytes, size_t pos)
+{
+    const size_t str = Deref(bytes, pos);
+
+    return std::string(reinterpret_cast<const char*>(&bytes.at(str + 4)), static_cast<size_t>(ReadLE(bytes, str, 4)));
+}
+
+static Bytes ExportStream(OCI_Resultset* rs)
+{
+    Bytes bytes;
+
+    FILE* file = tmpfile();
+
+    if (file)
+    {
+        if (OCI_ExportArrowStream(rs, fileno(file)))
+        {
+            unsigned char chunk[256];
+            size_t size = 0;
+
+            fseek(file, 0, SEEK_SET);
+
+            while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0)
+            {
+                bytes.insert(bytes.end(), chunk, chunk + size);
+            }
+        }
+
+        fclose(file);
+    }
+
+    return bytes;
+}
+
+TEST(TestArrow, Schema)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, ARROW_QUERY));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    ArrowSchema schema;
+    ASSERT_TRUE(OCI_GetArrowSchema(rs, &schema));
+
+    ASSERT_STREQ("+s", schema.format);
+    ASSERT_EQ(2, schema.n_children);
+    ASSERT_STREQ("l", schema.children[0]->format);
+    ASSERT_STREQ("ID", schema.children[0]->name);
+    ASSERT_STREQ("u", schema.children[1]->format);
+    ASSERT_STREQ("TXT", schema.children[1]->name);
+    ASSERT_EQ(ARROW_FLAG_NULLABLE, schema.children[1]->flags & ARROW_FLAG_NULLABLE);
+
+    ASSERT_NE(nullptr, schema.release);
+    schema.release(&schema);
+    ASSERT_EQ(nullptr, schema.release);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestArrow, FetchBatch)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, ARROW_QUERY));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    ArrowArray array;
+    ASSERT_EQ(3u, OCI_FetchArrowBatch(rs, &array));
+
+    ASSERT_EQ(3, array.length);
+    ASSERT_EQ(2, array.n_children);
+
+    const auto id = array.children[0];
+    ASSERT_EQ(0, id->null_count);
+    ASSERT_EQ(nullptr, id->buffers[0]);
+
+    const auto ids = static_cast<const int64_t*>(id->buffers[1]);
+    ASSERT_EQ(1, ids[0]);
+    ASSERT_EQ(2, ids[1]);
+    ASSERT_EQ(3, ids[2]);
+
+    const auto txt = array.children[1];
+    ASSERT_EQ(1, txt->null_count);
+    ASSERT_EQ(0x05, static_cast<const unsigned char*>(txt->buffers[0])[0] & 0x07);
+
+    const auto offsets = static_cast<const int32_t*>(txt->buffers[1]);
+    ASSERT_EQ(0, offsets[0]);
+    ASSERT_EQ(1, offsets[1]);
+    ASSERT_EQ(1, offsets[2]);
+    ASSERT_EQ(4, offsets[3]);
+    ASSERT_EQ(0, memcmp("xxxx", txt->buffers[2], 4));
+
+    array.release(&array);
+    ASSERT_EQ(nullptr, array.release);
+
+    ASSERT_EQ(0u, OCI_FetchArrowBatch(rs, &array));
+    ASSERT_EQ(nullptr, array.release);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestArrow, ExportStreamRoundTrip)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, ARROW_QUERY));
+    const Bytes bytes = ExportStream(OCI_GetResultset(stmt));
+    ASSERT_FALSE(bytes.empty());
+
+    /* the same rows exported through the C data interface */
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, ARROW_QUERY));
+
+    ArrowArray array;
+    ASSERT_EQ(3u, OCI_FetchArrowBatch(OCI_GetResultset(stmt), &array));
+
+    std::vector<int> headers;
+    size_t pos = 0;
+
+    while (ReadLE(bytes, pos + 4, 4) > 0)
+    {
+        ASSERT_EQ(0xFFFFFFFFu, ReadLE(bytes, pos, 4));
+
+        const size_t meta_size = static_cast<size_t>(ReadLE(bytes, pos + 4, 4));
+        const size_t meta      = pos + 8;
+        const size_t body      = meta + meta_size;
+
+        ASSERT_EQ(0u, meta_size % 8);
+
+        const size_t message = Deref(bytes, meta);
+        const size_t header  = Deref(bytes, GetField(bytes, message, 2));
+        const int    type    = static_cast<int>(ReadLE(bytes, GetField(bytes, message, 1), 1));
+        const size_t length  = static_cast<size_t>(ReadLE(bytes, GetField(bytes, message, 3), 8));
+
+        headers.push_back(type);
+
+        if (ARROW_HEADER_SCHEMA == type)
+        {
+            ASSERT_EQ(0u, length);
+
+            const size_t fields = Deref(bytes, GetField(bytes, header, 1));
+            ASSERT_EQ(2u, ReadLE(bytes, fields, 4));
+
+            const size_t id  = Deref(bytes, fields + 4);
+            const size_t txt = Deref(bytes, fields + 8);
+
+            ASSERT_EQ("ID", GetString(bytes, GetField(bytes, id, 0)));
+            ASSERT_EQ(ARROW_TYPE_INT, static_cast<int>(ReadLE(bytes, GetField(bytes, id, 2), 1)));
+            ASSERT_EQ("TXT", GetString(bytes, GetField(bytes, txt, 0)));
+            ASSERT_EQ(1u, ReadLE(bytes, GetField(bytes, txt, 1), 1));
+            ASSERT_EQ(ARROW_TYPE_UTF8, static_cast<int>(ReadLE(bytes, GetField(bytes, txt, 2), 1)));
+        }
+        else
+        {
+            ASSERT_EQ(ARROW_HEADER_RECORD_BATCH, type);
+            ASSERT_EQ(3u, ReadLE(bytes, GetField(bytes, header, 0), 8));
+
+            const size_t nodes   = Deref(bytes, GetField(bytes, header, 1));
+            const size_t buffers = Deref(bytes, GetField(bytes, header, 2));
+
+            ASSERT_EQ(2u, ReadLE(bytes, nodes, 4));
+            ASSERT_EQ(5u, ReadLE(bytes, buffers, 4));
+
+            /* every buffer of the body matches the one of the C data interface array */
+
+            size_t index = 0;
+
+            for (int64_t i = 0; i < array.n_children; i++)
+            {
+                const auto child = array.children[i];
+
+                ASSERT_EQ(static_cast<uint64_t>(child->length),     ReadLE(bytes, nodes + 4 + 16 * i, 8));
+                ASSERT_EQ(static_cast<uint64_t>(child->null_count), ReadLE(bytes, nodes + 4 + 16 * i + 8, 8));
+
+                for (int64_t j = 0; j < child->n_buffers; j++, index++)
+                {
+                    const size_t offset = static_cast<size_t>(ReadLE(bytes, buffers + 4 + 16 * index, 8));
+                    const size_t size   = static_cast<size_t>(ReadLE(bytes, buffers + 4 + 16 * index + 8, 8));
+
+                    ASSERT_LE(offset + size, length);
+
+                    if (size > 0)
+                    {
+                        ASSERT_NE(nullptr, child->buffers[j]);
+                        ASSERT_EQ(0, memcmp(&bytes.at(body + offset), child->buffers[j], size));
+                    }
+                    else
+                    {
+                        ASSERT_EQ(nullptr, child->buffers[j]);
+                    }
+                }
+            }
+        }
+
+        pos = body + length;
+    }
+
+    /* end of stream marker */
+
+    ASSERT_EQ(0xFFFFFFFFu, ReadLE(bytes, pos, 4));
+    ASSERT_EQ(pos + 8, bytes.size());
+    ASSERT_EQ((std::vector<int>{ ARROW_HEADER_SCHEMA, ARROW_HEADER_RECORD_BATCH }), headers);
+
+    array.release(&array);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
@@ -0,0 +1,284 @@
+#include "ocilib_tests.h"
+#include "../include/ocilib.hpp"
+
+using namespace ocilib;
+
+#define BATCH_WRITER_INSERT OTEXT("insert into test_batch_writer values (:id, :name)")
+
+static const std::vector<ostring> BatchWriterNames{ OTEXT(":id"), OTEXT(":name") };
+
+static void CreateBatchWriterTable(const Connection& conn)
+{
+    Statement stmt(conn);
+
+    try
+    {
+        stmt.Execute(OTEXT("drop table test_batch_writer"));
+    }
+    catch (Exception&)
+    {
+    }
+
+    stmt.Execute(OTEXT("create table test_batch_writer (id number primary key, name varchar2(100))"));
+}
+
+static void DropBatchWriterTable(const Connection& conn)
+{
+    Statement stmt(conn);
+    stmt.Execute(OTEXT("drop table test_batch_writer"));
+}
+
+static unsigned int CountBatchWriterRows(const Connection& conn)
+{
+    Statement stmt(conn);
+    stmt.Execute(OTEXT("select count(*) from test_batch_writer"));
+
+    Resultset rs = stmt.GetResultset();
+    rs.Next();
+
+    return rs.Get<unsigned int>(1);
+}
+
+TEST(TestBatchWriter, FlushOnThresholds)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        CreateBatchWriterTable(conn);
+
+        Statement stmt(conn);
+        stmt.Prepare(BATCH_WRITER_INSERT);
+
+        /* row count threshold */
+        {
+            BatchWriter<int, ostring> writer(stmt, BatchWriterNames, 3);
+
+            for (int i = 1; i <= 7; i++)
+            {
+                writer.Add(i, OTEXT("row"));
+            }
+
+            ASSERT_EQ(7u, writer.GetRowCount());
+            ASSERT_EQ(6u, writer.GetAffectedRows());
+            ASSERT_EQ(6u, CountBatchWriterRows(conn));
+
+            writer.Flush();
+
+            ASSERT_EQ(7u, writer.GetAffectedRows());
+            ASSERT_EQ(7u, CountBatchWriterRows(conn));
+        }
+
+        /* byte size threshold, empty strings are inserted as null and only ids are accounted */
+        {
+            BatchWriter<int, ostring> writer(stmt, BatchWriterNames, 100, 3 * sizeof(int));
+
+            for (int i = 11; i <= 15; i++)
+            {
+                writer.Add(i, OTEXT(""));
+            }
+
+            ASSERT_EQ(3u, writer.GetAffectedRows());
+            ASSERT_EQ(10u, CountBatchWriterRows(conn));
+
+            writer.Flush();
+
+            ASSERT_EQ(5u, writer.GetAffectedRows());
+            ASSERT_EQ(12u, CountBatchWriterRows(conn));
+        }
+
+        DropBatchWriterTable(conn);
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestBatchWriter, BackgroundFlush)
+{
+    Environment::Initialize(Environment::Threaded, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        CreateBatchWriterTable(conn);
+
+        Statement stmt(conn);
+        stmt.Prepare(BATCH_WRITER_INSERT);
+
+        {
+            BatchWriter<int, ostring> writer(stmt, BatchWriterNames, 4, 0, true);
+
+            for (int i = 1; i <= 10; i++)
+            {
+                writer.Add(i, OTEXT("background row"));
+            }
+
+            writer.Flush();
+
+            ASSERT_EQ(10u, writer.GetRowCount());
+            ASSERT_EQ(10u, writer.GetAffectedRows());
+            ASSERT_TRUE(writer.GetErrors().empty());
+        }
+
+        ASSERT_EQ(10u, CountBatchWriterRows(conn));
+
+        DropBatchWriterTable(conn);
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestBatchWriter, StringSlotResize)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        CreateBatchWriterTable(conn);
+
+        Statement stmt(conn);
+        stmt.Prepare(BATCH_WRITER_INSERT);
+
+        const std::vector<ostring> names
+        {
+            OTEXT("a"), ostring(40, OTEXT('b')), OTEXT("c"), ostring(90, OTEXT('d')), OTEXT("e")
+        };
+
+        {
+            /* slots are enlarged twice in the first batch and buffers are rebound before execution */
+
+            BatchWriter<int, ostring> writer(stmt, BatchWriterNames, 4);
+
+            for (size_t i = 0; i < names.size(); i++)
+            {
+                writer.Add(static_cast<int>(i + 1), names[i]);
+            }
+
+            writer.Flush();
+
+            ASSERT_EQ(5u, writer.GetAffectedRows());
+        }
+
+        Statement select(conn);
+        select.Execute(OTEXT("select name from test_batch_writer order by id"));
+
+        Resultset rs = select.GetResultset();
+
+        for (size_t i = 0; i < names.size(); i++)
+        {
+            ASSERT_TRUE(rs.Next());
+            ASSERT_EQ(names[i], rs.Get<ostring>(1));
+        }
+
+        ASSERT_FALSE(rs.Next());
+
+        DropBatchWriterTable(conn);
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestBatchWriter, RejectedRows)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        CreateBatchWriterTable(conn);
+
+        Statement stmt(conn);
+        stmt.Prepare(BATCH_WRITER_INSERT);
+
+        {
+            BatchWriter<int, ostring> writer(stmt, BatchWriterNames, 5);
+
+            writer.Add(1, OTEXT("a"));
+            writer.Add(2, OTEXT("b"));
+            writer.Add(2, OTEXT("duplicate"));
+            writer.Add(3, OTEXT("c"));
+            writer.Flush();
+
+            ASSERT_EQ(3u, writer.GetAffectedRows());
+            ASSERT_EQ(1u, writer.GetErrors().size());
+
+            const auto& error = writer.GetErrors()[0];
+            ASSERT_EQ(2u, error.GetIndex());
+            ASSERT_EQ(3u, error.GetException().GetRow());
+            ASSERT_EQ(1, error.GetException().GetOracleErrorCode());
+            ASSERT_EQ(2, std::get<0>(error.GetRow()));
+            ASSERT_EQ(ostring(OTEXT("duplicate")), std::get<1>(error.GetRow()));
+
+            writer.ClearErrors();
+
+            /* a single row is not executed as an array but its rejection is reported the same way */
+
+            writer.Add(3, OTEXT("again"));
+            writer.Flush();
+
+            ASSERT_EQ(3u, writer.GetAffectedRows());
+            ASSERT_EQ(1u, writer.GetErrors().size());
+            ASSERT_EQ(4u, writer.GetErrors()[0].GetIndex());
+            ASSERT_EQ(1u, writer.GetErrors()[0].GetException().GetRow());
+            ASSERT_EQ(1, writer.GetErrors()[0].GetException().GetOracleErrorCode());
+        }
+
+        ASSERT_EQ(3u, CountBatchWriterRows(conn));
+
+        DropBatchWriterTable(conn);
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestBatchWriter, BindNamesMismatch)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+
+        Statement stmt(conn);
+        stmt.Prepare(OTEXT("insert into test_batch_writer values (:id, :name)"));
+
+        int errorCode = 0;
+
+        try
+        {
+            BatchWriter<int, ostring> writer(stmt, { OTEXT(":id") }, 3);
+        }
+        catch (Exception& ex)
+        {
+            errorCode = ex.GetInternalErrorCode();
+        }
+
+        ASSERT_EQ(OCI_ERR_ARG_INVALID_VALUE, errorCode);
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestBatchWriter, StatementBoundAgainAfterDestruction)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        CreateBatchWriterTable(conn);
+
+        Statement stmt(conn);
+        stmt.Prepare(BATCH_WRITER_INSERT);
+
+        {
+            BatchWriter<int, ostring> writer(stmt, BatchWriterNames, 3);
+
+            writer.Add(1, OTEXT("writer"));
+            writer.Add(2, OTEXT("writer"));
+        }
+
+        /* the writer buffers are gone, the statement is prepared again without binds */
+
+        ASSERT_EQ(0u, stmt.GetBindCount());
+        ASSERT_EQ(ostring(BATCH_WRITER_INSERT), stmt.GetSql());
+
+        int id = 3;
+        ostring name = OTEXT("program");
+
+        stmt.Bind(OTEXT(":id"), id, BindInfo::In);
+        stmt.Bind(OTEXT(":name"), name, static_cast<unsigned int>(name.size()), BindInfo::In);
+        stmt.ExecutePrepared();
+
+        ASSERT_EQ(1u, stmt.GetAffectedRows());
+        ASSERT_EQ(3u, CountBatchWriterRows(conn));
+
+        DropBatchWriterTable(conn);
+    }
+    Environment::Cleanup();
+}
@@ -0,0 +1,136 @@
+#include "ocilib_tests.h"
+
+static void ExecuteBindTrackingDDL(OCI_Connection *conn, const otext *sql)
+{
+    const auto stmt = OCI_StatementCreate(conn);
+    OCI_ExecuteStmt(stmt, sql);
+    OCI_StatementFree(stmt);
+}
+
+static big_int SumBindTrackingValues(OCI_Connection *conn)
+{
+    const auto stmt = OCI_StatementCreate(conn);
+    OCI_ExecuteStmt(stmt, OTEXT("select sum(val) from test_bind_tracking"));
+
+    const auto rs = OCI_GetResultset(stmt);
+    OCI_FetchNext(rs);
+
+    const big_int sum = OCI_GetBigInt(rs, 1);
+
+    OCI_StatementFree(stmt);
+
+    return sum;
+}
+
+TEST(TestBind, TrackingSkipsUnchangedBinds)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ExecuteBindTrackingDDL(conn, OTEXT("drop table test_bind_tracking"));
+    ExecuteBindTrackingDDL(conn, OTEXT("create table test_bind_tracking (val number)"));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    big_int val = 1;
+
+    ASSERT_TRUE(OCI_EnableBindTracking(stmt, TRUE));
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into test_bind_tracking values (:val)")));
+    ASSERT_TRUE(OCI_BindBigInt(stmt, OTEXT(":val"), &val));
+
+    const auto bnd = OCI_GetBind(stmt, 1);
+    ASSERT_NE(nullptr, bnd);
+    ASSERT_TRUE(OCI_BindIsDirty(bnd));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_FALSE(OCI_BindIsDirty(bnd));
+
+    /* big_int values are converted by OCILIB, thus a modification not reported is ignored */
+
+    val = 10;
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(2, SumBindTrackingValues(conn));
+
+    /* once marked as modified, the new value is converted again */
+
+    ASSERT_TRUE(OCI_BindSetDirty(bnd));
+    ASSERT_TRUE(OCI_BindIsDirty(bnd));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_FALSE(OCI_BindIsDirty(bnd));
+    ASSERT_EQ(12, SumBindTrackingValues(conn));
+
+    /* setting a bind to null also marks it as modified */
+
+    ASSERT_TRUE(OCI_BindSetNull(bnd));
+    ASSERT_TRUE(OCI_BindIsDirty(bnd));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(12, SumBindTrackingValues(conn));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+
+    ExecuteBindTrackingDDL(conn, OTEXT("drop table test_bind_tracking"));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestBind, TrackingCopiesOutputValues)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ExecuteBindTrackingDDL(conn, OTEXT("drop table test_bind_tracking"));
+    ExecuteBindTrackingDDL(conn, OTEXT("create table test_bind_tracking (val number)"));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    big_int val = 1;
+    big_int ret = 0;
+
+    ASSERT_TRUE(OCI_EnableBindTracking(stmt, TRUE));
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into test_bind_tracking values (:val) returning val * 2 into :ret")));
+    ASSERT_TRUE(OCI_BindBigInt(stmt, OTEXT(":val"), &val));
+    ASSERT_TRUE(OCI_BindBigInt(stmt, OTEXT(":ret"), &ret));
+
+    /* the output bind keeps the default OCI_BDM_IN_OUT direction */
+
+    ASSERT_EQ(OCI_BDM_IN_OUT, OCI_BindGetDirection(OCI_GetBind2(stmt, OTEXT(":ret"))));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(2, ret);
+
+    /* output values are copied back even if the bind was not modified */
+
+    val = 5;
+
+    ASSERT_TRUE(OCI_BindSetDirty(OCI_GetBind2(stmt, OTEXT(":val"))));
+    ASSERT_FALSE(OCI_BindIsDirty(OCI_GetBind2(stmt, OTEXT(":ret"))));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(10, ret);
+
+    /* input only binds are not copied back */
+
+    ASSERT_TRUE(OCI_BindSetDirection(OCI_GetBind2(stmt, OTEXT(":ret")), OCI_BDM_IN));
+
+    ret = 0;
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(0, ret);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+
+    ExecuteBindTrackingDDL(conn, OTEXT("drop table test_bind_tracking"));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
@@ -0,0 +1,104 @@
+#include "ocilib_tests.h"
+#include "../include/ocilib.hpp"
+
+using namespace ocilib;
+
+TEST(TestBindArray, VectorResizedAfterInPlaceBinding)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        Statement stmt(conn);
+
+        try
+        {
+            stmt.Execute(OTEXT("drop table test_bind_array"));
+        }
+        catch (Exception&)
+        {
+        }
+
+        stmt.Execute(OTEXT("create table test_bind_array (id number)"));
+
+        std::vector<int> ids{ 1, 2, 3 };
+
+        stmt.Prepare(OTEXT("insert into test_bind_array values (:id)"));
+        stmt.SetBindArraySize(static_cast<unsigned int>(ids.size()));
+        stmt.Bind(OTEXT(":id"), ids, BindInfo::In);
+
+        /* the vector storage is bound in place */
+
+        stmt.ExecutePrepared();
+        ASSERT_EQ(3u, stmt.GetAffectedRows());
+
+        /* growing the vector moves its storage away from the bound buffer */
+
+        const int* data = ids.data();
+
+        ids.push_back(4);
+        ids.shrink_to_fit();
+
+        ASSERT_NE(data, ids.data());
+
+        int errorCode = 0;
+
+        try
+        {
+            stmt.ExecutePrepared();
+        }
+        catch (Exception& ex)
+        {
+            errorCode = ex.GetInternalErrorCode();
+        }
+
+        ASSERT_EQ(OCI_ERR_BIND_ARRAY_SIZE, errorCode);
+
+        stmt.Execute(OTEXT("drop table test_bind_array"));
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestBindArray, InPlaceBigIntWithBindTracking)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        Statement stmt(conn);
+
+        try
+        {
+            stmt.Execute(OTEXT("drop table test_bind_array"));
+        }
+        catch (Exception&)
+        {
+        }
+
+        stmt.Execute(OTEXT("create table test_bind_array (id number)"));
+
+        std::vector<big_int> ids{ 1, 2, 3 };
+
+        stmt.EnableBindTracking(true);
+        stmt.Prepare(OTEXT("insert into test_bind_array values (:id)"));
+        stmt.SetBindArraySize(static_cast<unsigned int>(ids.size()));
+        stmt.Bind(OTEXT(":id"), ids, BindInfo::In);
+        stmt.ExecutePrepared();
+
+        /* values modified in place are encoded again for the next execution */
+
+        ids[0] = 10;
+        ids[1] = 20;
+        ids[2] = 30;
+
+        stmt.ExecutePrepared();
+        ASSERT_EQ(3u, stmt.GetAffectedRows());
+
+        stmt.Execute(OTEXT("select sum(id) from test_bind_array"));
+
+        Resultset rs = stmt.GetResultset();
+        ASSERT_TRUE(rs.Next());
+        ASSERT_EQ(66, rs.Get<int>(1));
+
+        stmt.Execute(OTEXT("drop table test_bind_array"));
+    }
+    Environment::Cleanup();
+}
@@ -56,4 +56,70 @@ TEST(TestConnection, InvalidPassword)
 
     ASSERT_FALSE(OCI_ConnectionFree(conn));
     ASSERT_TRUE(OCI_Cleanup());
-}
\ No newline at end of file
+}
+#define CACHED_QUERY OTEXT("select :n + level from dual connect by level <= 3")
+
+TEST(TestConnection, CachedStatementReuse)
+{
+    Guard guard(context.Lock);
+    context.Errs.clear();
+
+    ASSERT_TRUE(OCI_Initialize(AddError, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    int value = 10;
+
+    const auto stmt = OCI_GetCachedStatement(conn, CACHED_QUERY);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, 2));
+    ASSERT_TRUE(OCI_SetPrefetchSize(stmt, 0));
+    ASSERT_TRUE(OCI_SetLongMaxSize(stmt, 100));
+    ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":n"), &value));
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_TRUE(OCI_FetchNext(OCI_GetResultset(stmt)));
+    ASSERT_EQ(11, OCI_GetInt(OCI_GetResultset(stmt), 1));
+
+    /* the statement goes back into the cache */
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+
+    const auto reused = OCI_GetCachedStatement(conn, CACHED_QUERY);
+    ASSERT_EQ(stmt, reused);
+
+    /* it is handed back as if it was just prepared */
+
+    ASSERT_EQ(0u, OCI_GetBindCount(reused));
+    ASSERT_EQ(static_cast<unsigned int>(OCI_FETCH_SIZE), OCI_GetFetchSize(reused));
+    ASSERT_EQ(static_cast<unsigned int>(OCI_PREFETCH_SIZE), OCI_GetPrefetchSize(reused));
+    ASSERT_EQ(static_cast<unsigned int>(OCI_SIZE_LONG), OCI_GetLongMaxSize(reused));
+
+    /* binds of the previous user are released */
+
+    ASSERT_FALSE(OCI_Execute(reused));
+    ASSERT_EQ(1, context.Errs.size());
+    ASSERT_EQ(1008, context.Errs[0].OCICode);
+
+    value = 20;
+
+    ASSERT_TRUE(OCI_BindInt(reused, OTEXT(":n"), &value));
+    ASSERT_TRUE(OCI_Execute(reused));
+
+    const auto rs = OCI_GetResultset(reused);
+    ASSERT_NE(nullptr, rs);
+
+    int expected = 20;
+
+    while (OCI_FetchNext(rs))
+    {
+        ASSERT_EQ(++expected, OCI_GetInt(rs, 1));
+    }
+
+    ASSERT_EQ(23, expected);
+
+    ASSERT_TRUE(OCI_StatementFree(reused));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
@@ -0,0 +1,112 @@
+#include "ocilib_tests.h"
+#include "../include/ocilib.hpp"
+
+using namespace ocilib;
+
+#define FOREACHAS_QUERY OTEXT("select level, 'row ' || level, level / 2, decode(mod(level, 5), 0, null, level) from dual connect by level <= 25")
+
+TEST(TestForEachAs, TuplesFromColumnOrder)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        Statement stmt(conn);
+
+        stmt.Execute(FOREACHAS_QUERY);
+
+        Resultset rs = stmt.GetResultset();
+
+        int expected = 0;
+
+        const unsigned int count = rs.ForEachAs<std::tuple<int, ostring, double, big_int>>([&expected](const std::tuple<int, ostring, double, big_int> &row)
+        {
+            expected++;
+
+            EXPECT_EQ(expected, std::get<0>(row));
+            EXPECT_EQ(ostring(OTEXT("row ")) + TO_STRING(expected), std::get<1>(row));
+            EXPECT_DOUBLE_EQ(expected / 2.0, std::get<2>(row));
+
+            /* null values are returned as default values */
+
+            EXPECT_EQ(expected % 5 == 0 ? 0 : expected, std::get<3>(row));
+
+            return true;
+        });
+
+        ASSERT_EQ(25u, count);
+        ASSERT_EQ(25, expected);
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestForEachAs, TuplesFromColumnNames)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        Statement stmt(conn);
+
+        stmt.Execute(OTEXT("select level as id, 'row ' || level as name from dual connect by level <= 25"));
+
+        Resultset rs = stmt.GetResultset();
+
+        std::vector<std::tuple<ostring, int>> rows;
+
+        /* the callback stops the fetch after 10 rows */
+
+        const unsigned int count = rs.ForEachAs<std::tuple<ostring, int>>({ OTEXT("NAME"), OTEXT("ID") }, [&rows](const std::tuple<ostring, int> &row)
+        {
+            rows.push_back(row);
+
+            return rows.size() < 10;
+        });
+
+        ASSERT_EQ(10u, count);
+        ASSERT_EQ(10u, rows.size());
+        ASSERT_EQ(ostring(OTEXT("row 10")), std::get<0>(rows[9]));
+        ASSERT_EQ(10, std::get<1>(rows[9]));
+
+        /* fetching can be resumed from the next row */
+
+        ASSERT_TRUE(rs.Next());
+        ASSERT_EQ(11, rs.Get<int>(1));
+    }
+    Environment::Cleanup();
+}
+
+TEST(TestForEachAs, ColumnTypeMismatch)
+{
+    Environment::Initialize(Environment::Default, HOME);
+    {
+        Connection conn(DBS, USR, PWD);
+        Statement stmt(conn);
+
+        stmt.Execute(FOREACHAS_QUERY);
+
+        Resultset rs = stmt.GetResultset();
+
+        int errorCode = 0;
+        int calls = 0;
+
+        try
+        {
+            rs.ForEachAs<std::tuple<int, Date>>([&calls](const std::tuple<int, Date> &)
+            {
+                calls++;
+
+                return true;
+            });
+        }
+        catch (Exception &ex)
+        {
+            errorCode = ex.GetInternalErrorCode();
+        }
+
+        /* types are checked before fetching any row */
+
+        ASSERT_EQ(OCI_ERR_NOT_COMPATIBLE, errorCode);
+        ASSERT_EQ(0, calls);
+        ASSERT_EQ(0u, rs.GetCurrentRow());
+    }
+    Environment::Cleanup();
+}
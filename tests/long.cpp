@@ -0,0 +1,117 @@
+#include "ocilib_tests.h"
+
+#include <map>
+
+/* U+1F600 is a surrogate pair in UTF-16 */
+
+#define LONG_PIECES_SUFFIX OTEXT("\U0001F600z")
+
+static std::map<unsigned int, ostring> LongPiecesValues;
+static unsigned int LongPiecesCount = 0;
+static unsigned int LongPiecesLoneSurrogates = 0;
+
+static void LongPiecesHandler(OCI_Resultset *, unsigned int, unsigned int row, const void *buffer, unsigned int size, boolean)
+{
+    const otext *piece = static_cast<const otext *>(buffer);
+
+    LongPiecesCount++;
+
+    /* with 4 bytes characters, a surrogate pair split between pieces would show up as lone surrogates */
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        const unsigned int c = static_cast<unsigned int>(piece[i]);
+
+        if (sizeof(otext) == 4 && c >= 0xD800 && c <= 0xDFFF)
+        {
+            LongPiecesLoneSurrogates++;
+        }
+    }
+
+    LongPiecesValues[row].append(piece, size);
+}
+
+static void ExecuteLongDDL(OCI_Connection *conn, const otext *sql)
+{
+    const auto stmt = OCI_StatementCreate(conn);
+    OCI_ExecuteStmt(stmt, sql);
+    OCI_StatementFree(stmt);
+}
+
+TEST(TestLong, StreamPiecesWithSplitSurrogates)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ExecuteLongDDL(conn, OTEXT("drop table test_long_pieces"));
+    ExecuteLongDDL(conn, OTEXT("create table test_long_pieces (id number, val long)"));
+
+    /* each row shifts the surrogate pair by one character, so that it ends up
+       split between two pieces for at least one of them */
+
+    std::vector<ostring> values;
+
+    int id = 0;
+    otext val[64] = {};
+
+    const auto insert = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, insert);
+    ASSERT_TRUE(OCI_Prepare(insert, OTEXT("insert into test_long_pieces values (:id, :val)")));
+    ASSERT_TRUE(OCI_BindInt(insert, OTEXT(":id"), &id));
+    ASSERT_TRUE(OCI_BindString(insert, OTEXT(":val"), val, 63));
+
+    for (id = 0; id < 20; id++)
+    {
+        values.push_back(ostring(id, OTEXT('a')) + LONG_PIECES_SUFFIX);
+
+        std::copy(values.back().begin(), values.back().end(), val);
+        val[values.back().size()] = 0;
+
+        ASSERT_TRUE(OCI_Execute(insert));
+    }
+
+    ASSERT_TRUE(OCI_StatementFree(insert));
+
+    LongPiecesValues.clear();
+    LongPiecesCount = 0;
+    LongPiecesLoneSurrogates = 0;
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    /* small pieces of a few characters */
+
+    ASSERT_TRUE(OCI_SetLongMaxSize(stmt, 30));
+    ASSERT_TRUE(OCI_SetLongHandler(stmt, LongPiecesHandler));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select val from test_long_pieces order by id")));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    unsigned int rows = 0;
+
+    while (OCI_FetchNext(rs))
+    {
+        rows++;
+    }
+
+    ASSERT_EQ(values.size(), rows);
+    ASSERT_LT(values.size(), LongPiecesCount);
+    ASSERT_EQ(0u, LongPiecesLoneSurrogates);
+
+    /* pieces put back together give the original values */
+
+    for (unsigned int i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(values[i], LongPiecesValues[i + 1]);
+    }
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+
+    ExecuteLongDDL(conn, OTEXT("drop table test_long_pieces"));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
@@ -499,6 +499,116 @@ TEST(TestNumber, TestNegativeInfinity)
     ASSERT_TRUE(OCI_Cleanup());
 }
 
+template<typename T, int C>
+void DecodeContent(std::vector<unsigned char> content, T expected)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto number = OCI_NumberCreate(nullptr);
+    T value{};
+
+    content.resize(22);
+
+    ASSERT_TRUE(OCI_NumberSetContent(number, content.data()));
+    ASSERT_TRUE(OCI_NumberGetValue(number, C, &value));
+    ASSERT_EQ(expected, value);
+
+    ASSERT_TRUE(OCI_NumberFree(number));
+
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestNumber, DecodeContentZero)
+{
+    DecodeContent<int, OCI_NUM_INT>({ 1, 128 }, 0);
+    DecodeContent<double, OCI_NUM_DOUBLE>({ 1, 128 }, 0.0);
+}
+
+TEST(TestNumber, DecodeContentSignedShort)
+{
+    DecodeContent<short, OCI_NUM_SHORT>({ 3, 62, 100, 102 }, -1);
+    DecodeContent<short, OCI_NUM_SHORT>({ 4, 195, 4, 28, 68 }, 32767);
+    DecodeContent<short, OCI_NUM_SHORT>({ 5, 60, 98, 74, 33, 102 }, -32768);
+}
+
+TEST(TestNumber, DecodeContentUnsignedInt)
+{
+    DecodeContent<unsigned int, OCI_NUM_UINT>({ 6, 197, 43, 95, 97, 73, 96 }, 4294967295);
+}
+
+TEST(TestNumber, DecodeContentSignedInt)
+{
+    DecodeContent<int, OCI_NUM_INT>({ 4, 61, 100, 78, 102 }, -123);
+    DecodeContent<int, OCI_NUM_INT>({ 2, 196, 2 }, 1000000);
+}
+
+TEST(TestNumber, DecodeContentUnsignedBigInt)
+{
+    DecodeContent<big_uint, OCI_NUM_BIGUINT>({ 11, 202, 19, 45, 68, 45, 8, 38, 10, 56, 17, 16 }, 18446744073709551615ULL);
+}
+
+TEST(TestNumber, DecodeContentSignedBigInt)
+{
+    DecodeContent<big_int, OCI_NUM_BIGINT>({ 11, 202, 10, 23, 34, 73, 4, 69, 55, 78, 59, 8 }, 9223372036854775807LL);
+    DecodeContent<big_int, OCI_NUM_BIGINT>({ 12, 53, 92, 79, 68, 29, 98, 33, 47, 24, 43, 93, 102 }, -9223372036854775807LL - 1);
+}
+
+TEST(TestNumber, DecodeContentDouble)
+{
+    DecodeContent<double, OCI_NUM_DOUBLE>({ 3, 193, 4, 15 }, 3.14);
+    DecodeContent<double, OCI_NUM_DOUBLE>({ 2, 192, 51 }, 0.5);
+    DecodeContent<double, OCI_NUM_DOUBLE>({ 4, 62, 98, 87, 102 }, -3.14);
+}
+
+template<typename T, int C>
+void EncodeContent(T value, std::vector<unsigned char> expected)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto number = OCI_NumberCreate(nullptr);
+
+    ASSERT_TRUE(OCI_NumberSetValue(number, C, &value));
+
+    const auto content = OCI_NumberGetContent(number);
+    ASSERT_TRUE(nullptr != content);
+    ASSERT_EQ(expected, std::vector<unsigned char>(content, content + expected.size()));
+
+    ASSERT_TRUE(OCI_NumberFree(number));
+
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestNumber, EncodeContentZero)
+{
+    EncodeContent<int, OCI_NUM_INT>(0, { 1, 128 });
+}
+
+TEST(TestNumber, EncodeContentSignedShort)
+{
+    EncodeContent<short, OCI_NUM_SHORT>(-1, { 3, 62, 100, 102 });
+    EncodeContent<short, OCI_NUM_SHORT>(-32768, { 5, 60, 98, 74, 33, 102 });
+}
+
+TEST(TestNumber, EncodeContentSignedInt)
+{
+    EncodeContent<int, OCI_NUM_INT>(1000000, { 2, 196, 2 });
+    EncodeContent<int, OCI_NUM_INT>(-123, { 4, 61, 100, 78, 102 });
+}
+
+TEST(TestNumber, EncodeContentUnsignedBigInt)
+{
+    EncodeContent<big_uint, OCI_NUM_BIGUINT>(18446744073709551615ULL, { 11, 202, 19, 45, 68, 45, 8, 38, 10, 56, 17, 16 });
+}
+
+TEST(TestNumber, EncodeContentSignedBigInt)
+{
+    EncodeContent<big_int, OCI_NUM_BIGINT>(-9223372036854775807LL - 1, { 12, 53, 92, 79, 68, 29, 98, 33, 47, 24, 43, 93, 102 });
+}
+
+TEST(TestNumber, EncodeContentDouble)
+{
+    EncodeContent<double, OCI_NUM_DOUBLE>(-123.0, { 4, 61, 100, 78, 102 });
+}
 
 
 /*
@@ -0,0 +1,505 @@
+#include "ocilib_tests.h"
+
+#define BATCH_QUERY OTEXT("select case when mod(level, 3) = 0 then null else level end from dual connect by level <= 25")
+
+TEST(TestResultset, FetchBatch)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, BATCH_QUERY));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    std::vector<unsigned int> counts;
+    unsigned int rows = 0, total = 0;
+
+    while (OCI_FetchBatch(rs, &rows))
+    {
+        counts.push_back(rows);
+
+        const short *inds = OCI_GetBatchIndicators(rs, 1);
+        ASSERT_NE(nullptr, inds);
+
+        unsigned int stride = 0;
+        ASSERT_NE(nullptr, OCI_GetBatchData(rs, 1, &stride));
+        ASSERT_NE(0u, stride);
+
+        std::vector<int> values(rows);
+        ASSERT_EQ(rows, OCI_GetBatchNumbers(rs, 1, values.data(), OCI_NUM_INT));
+
+        for (unsigned int i = 0; i < rows; i++)
+        {
+            const int level = static_cast<int>(total + i + 1);
+
+            if (level % 3 == 0)
+            {
+                ASSERT_EQ(-1, inds[i]);
+                ASSERT_EQ(0, values[i]);
+            }
+            else
+            {
+                ASSERT_NE(-1, inds[i]);
+                ASSERT_EQ(level, values[i]);
+            }
+        }
+
+        total += rows;
+    }
+
+    ASSERT_EQ(25u, total);
+    ASSERT_EQ(25u, OCI_GetRowCount(rs));
+    ASSERT_EQ((std::vector<unsigned int>{ 10, 10, 5 }), counts);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestResultset, FetchNextEndsBatch)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level from dual connect by level <= 25")));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    std::vector<int> values(ARRAY_SIZE);
+    unsigned int rows = 0;
+
+    ASSERT_TRUE(OCI_FetchBatch(rs, &rows));
+    ASSERT_EQ(10u, rows);
+    ASSERT_EQ(rows, OCI_GetBatchNumbers(rs, 1, values.data(), OCI_NUM_INT));
+
+    /* moving to the next row discards the batch */
+
+    ASSERT_TRUE(OCI_FetchNext(rs));
+    ASSERT_EQ(11, OCI_GetInt(rs, 1));
+
+    ASSERT_EQ(nullptr, OCI_GetBatchData(rs, 1, nullptr));
+    ASSERT_EQ(nullptr, OCI_GetBatchIndicators(rs, 1));
+    ASSERT_EQ(0u, OCI_GetBatchNumbers(rs, 1, values.data(), OCI_NUM_INT));
+
+    /* the next batch starts after the current row */
+
+    ASSERT_TRUE(OCI_FetchNext(rs));
+    ASSERT_TRUE(OCI_FetchBatch(rs, &rows));
+    ASSERT_EQ(8u, rows);
+    ASSERT_EQ(rows, OCI_GetBatchNumbers(rs, 1, values.data(), OCI_NUM_INT));
+    ASSERT_EQ(13, values[0]);
+    ASSERT_EQ(20, values[7]);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+#define PIPELINE_QUERY OTEXT("select level from dual connect by level <= :n")
+
+TEST(TestResultset, PipelinedFetchReExecute)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int count = 25;
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_SetPipelinedFetch(stmt, TRUE));
+    ASSERT_TRUE(OCI_Prepare(stmt, PIPELINE_QUERY));
+    ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":n"), &count));
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    /* stop in the middle of the second array while the third one is fetched in background */
+
+    for (int i = 1; i <= 15; i++)
+    {
+        ASSERT_TRUE(OCI_FetchNext(rs));
+        ASSERT_EQ(i, OCI_GetInt(rs, 1));
+    }
+
+    /* rows fetched in background are not reported until their array is reached */
+
+    ASSERT_EQ(15u, OCI_GetCurrentRow(rs));
+    ASSERT_EQ(20u, OCI_GetRowCount(rs));
+    ASSERT_EQ(20u, OCI_GetAffectedRows(stmt));
+
+    /* re-execution must discard the pending rows of the previous execution */
+
+    count = 12;
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    int expected = 0;
+
+    while (OCI_FetchNext(rs))
+    {
+        ASSERT_EQ(++expected, OCI_GetInt(rs, 1));
+    }
+
+    ASSERT_EQ(12, expected);
+    ASSERT_EQ(12u, OCI_GetRowCount(rs));
+    ASSERT_EQ(12u, OCI_GetAffectedRows(stmt));
+
+    /* disabling pipelined fetch applies to the next execution */
+
+    ASSERT_TRUE(OCI_SetPipelinedFetch(stmt, FALSE));
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    expected = 0;
+
+    while (OCI_FetchNext(rs))
+    {
+        ASSERT_EQ(++expected, OCI_GetInt(rs, 1));
+    }
+
+    ASSERT_EQ(12, expected);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestResultset, PipelinedFetchFreePending)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_SetPipelinedFetch(stmt, TRUE));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level from dual connect by level <= 1000")));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    /* the next array is being fetched in background after the first fetch */
+
+    ASSERT_TRUE(OCI_FetchNext(rs));
+    ASSERT_EQ(1, OCI_GetInt(rs, 1));
+
+    /* releasing the resultset and the statement must wait for it */
+
+    ASSERT_TRUE(OCI_ReleaseResultsets(stmt));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select 1 from dual")));
+
+    const auto rs2 = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs2);
+    ASSERT_TRUE(OCI_FetchNext(rs2));
+    ASSERT_EQ(1, OCI_GetInt(rs2, 1));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level from dual connect by level <= 1000")));
+    ASSERT_TRUE(OCI_FetchNext(OCI_GetResultset(stmt)));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+#define CACHE_QUERY OTEXT("select level + :k from dual connect by level <= :n")
+
+TEST(TestResultset, FetchCacheReExecute)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int base = 0, count = 25;
+
+    ASSERT_TRUE(OCI_SetFetchMode(stmt, OCI_SFM_SCROLLABLE));
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_SetFetchCacheSize(stmt, 100));
+    ASSERT_TRUE(OCI_Prepare(stmt, CACHE_QUERY));
+    ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":k"), &base));
+    ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":n"), &count));
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    /* cache all the rows and record the end of the resultset */
+
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 25));
+    ASSERT_EQ(25, OCI_GetInt(rs, 1));
+    ASSERT_FALSE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 26));
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 5));
+    ASSERT_EQ(5, OCI_GetInt(rs, 1));
+
+    /* the same resultset is reused by the next execution that must not serve cached rows
+       nor stop at the end of the previous execution */
+
+    base  = 100;
+    count = 40;
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 5));
+    ASSERT_EQ(105, OCI_GetInt(rs, 1));
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 30));
+    ASSERT_EQ(130, OCI_GetInt(rs, 1));
+    ASSERT_TRUE(OCI_FetchLast(rs));
+    ASSERT_EQ(140, OCI_GetInt(rs, 1));
+    ASSERT_EQ(40u, OCI_GetRowCount(rs));
+
+    ASSERT_TRUE(OCI_FetchFirst(rs));
+    ASSERT_EQ(101, OCI_GetInt(rs, 1));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+#define ROUNDTRIPS_QUERY OTEXT("select m.value from v$mystat m join v$statname n on n.statistic# = m.statistic# ") \
+                         OTEXT("where n.name = 'SQL*Net roundtrips to/from client'")
+
+static unsigned int GetRoundTrips(OCI_Statement* stmt)
+{
+    OCI_Resultset* rs = OCI_Execute(stmt) ? OCI_GetResultset(stmt) : nullptr;
+
+    return rs && OCI_FetchNext(rs) ? OCI_GetUnsignedInt(rs, 1) : 0;
+}
+
+TEST(TestResultset, FetchCacheEviction)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    const auto trips = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, trips);
+    ASSERT_TRUE(OCI_Prepare(trips, ROUNDTRIPS_QUERY));
+
+    /* round trips needed to read the statistic itself */
+
+    const unsigned int start = GetRoundTrips(trips);
+    const unsigned int probe = GetRoundTrips(trips) - start;
+
+    ASSERT_NE(0u, start);
+
+    /* room for 2 arrays of rows */
+
+    ASSERT_TRUE(OCI_SetFetchMode(stmt, OCI_SFM_SCROLLABLE));
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_SetFetchCacheSize(stmt, 2 * ARRAY_SIZE));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level from dual connect by level <= 50")));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 1));
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 11));
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 21));
+
+    /* rows 1-10 were the least recently used ones when rows 21-30 were stored */
+
+    unsigned int before = GetRoundTrips(trips);
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 15));
+    ASSERT_EQ(15, OCI_GetInt(rs, 1));
+    ASSERT_EQ(probe, GetRoundTrips(trips) - before);
+
+    /* rows 11-20 were used last, so storing rows 31-40 evicts rows 21-30 */
+
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 31));
+
+    before = GetRoundTrips(trips);
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 12));
+    ASSERT_EQ(12, OCI_GetInt(rs, 1));
+    ASSERT_EQ(probe, GetRoundTrips(trips) - before);
+
+    before = GetRoundTrips(trips);
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 25));
+    ASSERT_EQ(25, OCI_GetInt(rs, 1));
+    ASSERT_LT(probe, GetRoundTrips(trips) - before);
+
+    before = GetRoundTrips(trips);
+    ASSERT_TRUE(OCI_FetchSeek(rs, OCI_SFD_ABSOLUTE, 5));
+    ASSERT_EQ(5, OCI_GetInt(rs, 1));
+    ASSERT_LT(probe, GetRoundTrips(trips) - before);
+
+    ASSERT_TRUE(OCI_StatementFree(trips));
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestResultset, FetchMemoryGrowth)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    /* arrays of rows double after each full fetch within a single execution */
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_SetFetchMemory(stmt, 1024 * 1024));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level from dual connect by level <= 1000")));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    std::vector<unsigned int> counts;
+    unsigned int rows = 0, total = 0;
+
+    while (OCI_FetchBatch(rs, &rows))
+    {
+        std::vector<int> values(rows);
+        ASSERT_EQ(rows, OCI_GetBatchNumbers(rs, 1, values.data(), OCI_NUM_INT));
+
+        for (unsigned int i = 0; i < rows; i++)
+        {
+            ASSERT_EQ(static_cast<int>(total + i + 1), values[i]);
+        }
+
+        counts.push_back(rows);
+        total += rows;
+    }
+
+    ASSERT_EQ(1000u, total);
+    ASSERT_EQ((std::vector<unsigned int>{ 10, 20, 40, 80, 160, 320, 370 }), counts);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestResultset, GetStructsPaddedLayout)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    /* members of different sizes and alignments require padding between them */
+
+    struct Row
+    {
+        short    id;
+        big_int  big;
+        otext   *name;
+        double   ratio;
+        short    flag;
+        float    half;
+    };
+
+    struct RowInd
+    {
+        boolean id;
+        boolean big;
+        boolean name;
+        boolean ratio;
+        boolean flag;
+        boolean half;
+    };
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level, level * 1000000000, ")
+                                      OTEXT("case when mod(level, 5) = 0 then null else 'row ' || level end, ")
+                                      OTEXT("level / 4, mod(level, 2), level / 2 ")
+                                      OTEXT("from dual connect by level <= 25")));
+
+    const auto rs = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rs);
+
+    ASSERT_TRUE(OCI_SetStructNumericType(rs, 1, OCI_NUM_SHORT));
+    ASSERT_TRUE(OCI_SetStructNumericType(rs, 4, OCI_NUM_DOUBLE));
+    ASSERT_TRUE(OCI_SetStructNumericType(rs, 5, OCI_NUM_SHORT));
+    ASSERT_TRUE(OCI_SetStructNumericType(rs, 6, OCI_NUM_FLOAT));
+
+    Row rows[ARRAY_SIZE];
+    RowInd inds[ARRAY_SIZE];
+
+    unsigned int count = 0, total = 0;
+
+    while (OCI_FetchBatch(rs, &count))
+    {
+        memset(rows, 0, sizeof(rows));
+        memset(inds, 0, sizeof(inds));
+
+        ASSERT_EQ(count, OCI_GetStructs(rs, rows, inds, ARRAY_SIZE));
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            const int level = static_cast<int>(total + i + 1);
+
+            ASSERT_EQ(level, rows[i].id);
+            ASSERT_EQ(level * 1000000000LL, rows[i].big);
+            ASSERT_DOUBLE_EQ(level / 4.0, rows[i].ratio);
+            ASSERT_EQ(level % 2, rows[i].flag);
+            ASSERT_FLOAT_EQ(level / 2.0f, rows[i].half);
+
+            ASSERT_TRUE(inds[i].id);
+            ASSERT_TRUE(inds[i].big);
+            ASSERT_TRUE(inds[i].ratio);
+            ASSERT_TRUE(inds[i].flag);
+            ASSERT_TRUE(inds[i].half);
+
+            if (level % 5 == 0)
+            {
+                ASSERT_FALSE(inds[i].name);
+            }
+            else
+            {
+                ASSERT_TRUE(inds[i].name);
+                ASSERT_EQ(ostring(OTEXT("row ")) + TO_STRING(level), ostring(rows[i].name));
+            }
+        }
+
+        total += count;
+    }
+
+    ASSERT_EQ(25u, total);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
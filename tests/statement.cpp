@@ -0,0 +1,89 @@
+#include "ocilib_tests.h"
+
+static void ExecuteChunksDDL(OCI_Connection *conn, const otext *sql)
+{
+    const auto stmt = OCI_StatementCreate(conn);
+    OCI_ExecuteStmt(stmt, sql);
+    OCI_StatementFree(stmt);
+}
+
+TEST(TestStatement, ChunkedArrayExecution)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ExecuteChunksDDL(conn, OTEXT("drop table test_chunks"));
+    ExecuteChunksDDL(conn, OTEXT("create table test_chunks (id number primary key)"));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    /* rows 4, 9 and 12 are duplicates, the 2 last ones are in the third chunk */
+
+    int ids[12] = { 1, 2, 3, 3, 5, 6, 7, 8, 8, 10, 11, 11 };
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into test_chunks values (:id)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, 12));
+    ASSERT_TRUE(OCI_BindArraySetChunkSize(stmt, 4));
+    ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":id"), ids, 0));
+
+    ASSERT_FALSE(OCI_Execute(stmt));
+
+    /* rows affected by all chunks */
+
+    ASSERT_EQ(9u, OCI_GetAffectedRows(stmt));
+
+    /* rows in error are numbered from the first row of the whole bind arrays */
+
+    ASSERT_EQ(3u, OCI_GetBatchErrorCount(stmt));
+
+    std::vector<unsigned int> rows;
+
+    for (auto err = OCI_GetBatchError(stmt); err; err = OCI_GetBatchError(stmt))
+    {
+        ASSERT_EQ(1, OCI_ErrorGetOCICode(err));
+
+        rows.push_back(OCI_ErrorGetRow(err));
+    }
+
+    ASSERT_EQ((std::vector<unsigned int>{ 4, 9, 12 }), rows);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+
+    ExecuteChunksDDL(conn, OTEXT("drop table test_chunks"));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestStatement, ChunkedArrayExecutionErrorPosition)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int ids[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into test_chunks_missing values (:id)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, 12));
+    ASSERT_TRUE(OCI_BindArraySetChunkSize(stmt, 4));
+    ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":id"), ids, 0));
+
+    ASSERT_FALSE(OCI_Execute(stmt));
+
+    /* the missing table is reported by the first chunk and stops the execution */
+
+    ASSERT_EQ(12u, OCI_GetSqlErrorPos(stmt));
+    ASSERT_EQ(0u, OCI_GetAffectedRows(stmt));
+    ASSERT_EQ(0u, OCI_GetBatchErrorCount(stmt));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}